@@ -0,0 +1,73 @@
+#pragma once
+
+/**
+ * Size of a pneumatic cylinder and the tubing between it and its solenoid, all in inches.
+ */
+struct Cylinder {
+  double bore;
+  double stroke;
+  double rod = 0.0;             // rod diameter, only matters for double acting cylinders
+  bool double_acting = false;  // single acting cylinders spring back and don't use air to retract
+  double tubing = 0.0;         // in^3 of tubing that's filled and dumped with the cylinder
+
+  /**
+   * Returns in^3 filled when the cylinder extends.
+   */
+  double extend_volume() const;
+
+  /**
+   * Returns in^3 filled when the cylinder retracts.
+   */
+  double retract_volume() const;
+};
+
+/**
+ * Estimates how much air is left in the tank.
+ *
+ * Every actuation lets the tank fill an empty cylinder and the pressure settles between them,
+ * so in gauge pressure each one leaves tank * volume / (volume + cylinder) behind.
+ */
+class AirTank {
+ public:
+  struct Constants {
+    double volume = 12.2;          // in^3 of tank and the tubing that's always pressurized, 12.2 is a 200 mL tank
+    double start_pressure = 100;  // psi the tank is pumped to before a match
+    double min_pressure = 40;     // psi below which the pistons don't move reliably
+  };
+
+  AirTank();
+  AirTank(Constants constants);
+
+  /**
+   * Fills an empty volume from the tank.
+   *
+   * \param volume
+   *        in^3 that was filled
+   */
+  void use(double volume);
+
+  /**
+   * Returns the estimated tank pressure, psi.
+   */
+  double pressure_get() const;
+
+  /**
+   * Returns the pressure left after filling a volume from a tank at some pressure, psi.
+   */
+  double pressure_after(double pressure, double volume) const;
+
+  /**
+   * Returns true while there's enough pressure to actuate.
+   */
+  bool usable(double pressure) const;
+
+  /**
+   * Sets the pressure back to start_pressure, for after pumping the tank back up.
+   */
+  void refill();
+
+  Constants constants;
+
+ private:
+  double pressure = 0;
+};
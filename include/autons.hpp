@@ -18,7 +18,7 @@ void odom_boomerang_injected_pure_pursuit_example();
 void measure_offsets();
 
 // custom autos
-void match_loader();
+int match_loader(int balls = 5, int timeout = 3000);
 void skills_bottom_bot();
 void skills_top_bot();
 void head_two_head_bottom(const std::string& color);
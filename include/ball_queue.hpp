@@ -0,0 +1,86 @@
+#pragma once
+
+/**
+ * Tracks where every ball is along the conveyor.
+ *
+ * Balls enter at the intake and are moved along by how far each conveyor stage's belt travels.
+ * A ball in the bottom stage waits at the top stage when the top stage isn't running, and balls
+ * can't get closer together than one ball.  Running the belts backwards pushes balls back out
+ * the intake, and a ball that makes it past the top stage has left through the outtake.
+ *
+ * Nothing in here talks to hardware, every input is passed in.
+ */
+class BallQueue {
+ public:
+  struct Constants {
+    double bottom_length = 10.0;  // in of travel from the intake to the top stage
+    double top_length = 8.0;      // in of travel through the top stage to the outtake
+    double ball_spacing = 3.5;    // in between ball centers when they're touching
+    int capacity = 5;             // balls the robot can hold
+  };
+
+  static const int MAX_BALLS = 8;
+
+  BallQueue();
+  BallQueue(Constants constants);
+
+  /**
+   * Adds a ball at the intake.
+   */
+  void enter();
+
+  /**
+   * Moves every ball along the conveyor.
+   *
+   * \param bottom_travel
+   *        in the bottom stage's belt moved since the last call
+   * \param top_travel
+   *        in the top stage's belt moved since the last call
+   * \param ejecting
+   *        true when balls leaving the outtake are being thrown away instead of scored
+   */
+  void advance(double bottom_travel, double top_travel, bool ejecting);
+
+  /**
+   * Returns how many balls are in the robot.
+   */
+  int count_get() const;
+
+  /**
+   * Returns true when the robot can't hold any more.
+   */
+  bool full() const;
+
+  /**
+   * Returns how far a ball is along the conveyor, in.  0 is the ball closest to the outtake.
+   */
+  double position_get(int ball) const;
+
+  /**
+   * Returns how many balls have left through the outtake into a goal.
+   */
+  int scored_get() const;
+
+  /**
+   * Returns how many balls have left through the outtake while ejecting.
+   */
+  int ejected_get() const;
+
+  /**
+   * Starts counting scored balls from 0.
+   */
+  void scored_reset();
+
+  /**
+   * Forgets every ball in the robot.
+   */
+  void clear();
+
+  Constants constants;
+
+ private:
+  double positions[MAX_BALLS] = {};  // Front of the robot first
+  int count = 0;
+  int scored = 0;
+  int ejected = 0;
+};
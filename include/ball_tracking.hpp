@@ -0,0 +1,58 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "ball_queue.hpp"
+#include "speed_config.hpp"
+
+// Distance sensor looking across the intake, a ball passing in front of it has entered the robot
+inline pros::Distance intake_entry_sensor(16);
+inline const int intake_entry_enter = 60;  // mm, closer than this is a ball
+inline const int intake_entry_exit = 90;   // mm, further than this is clear again
+
+/**
+ * Counts balls coming in and moves them along with the conveyor encoders.  This is run by the subsystem task every tick.
+ *
+ * \param ejecting
+ *        true while color sorting is throwing balls away
+ */
+void ball_tracking_iterate(bool ejecting);
+
+/**
+ * Returns how many balls are in the robot.
+ */
+int balls_held_get();
+
+/**
+ * Returns true when the robot can't hold any more.
+ */
+bool balls_full();
+
+/**
+ * Returns the most balls the robot can hold.
+ */
+int balls_capacity_get();
+
+/**
+ * Returns how many balls have been scored since the last reset.
+ */
+int balls_scored_get();
+
+/**
+ * Starts counting scored balls from 0.
+ */
+void balls_scored_reset();
+
+/**
+ * Scores until enough balls have left the robot or it times out, then stops the subsystems.
+ * Returns how many balls were scored.  When the count is 0 or less nothing is known about what's
+ * in the robot, so it scores for the whole timeout.
+ *
+ * \param goal
+ *        SCORE for long goals, SCORE_SLOWLY for middle goals
+ * \param count
+ *        balls to score
+ * \param timeout
+ *        ms to give up after
+ */
+int score_balls(state goal, int count, int timeout);
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+
+/**
+ * One piece of startup that runs in its own task, so slow things like IMU calibration and SD
+ * card reads overlap instead of waiting on each other.  initialize() starts every phase and then
+ * only joins the ones autonomous needs.
+ */
+class BootPhase {
+ public:
+  /**
+   * \param name
+   *        name shown in the boot report and used for the task
+   * \param work
+   *        what to run
+   * \param after
+   *        phase that has to finish before this one starts, for things that share a device
+   */
+  BootPhase(const char* name, void (*work)(), BootPhase* after = nullptr);
+
+  /**
+   * Starts the phase in a new task.
+   */
+  void start();
+
+  /**
+   * Waits until the phase is done.
+   */
+  void join() const;
+
+  /**
+   * Returns true once the phase is done.
+   */
+  bool done() const;
+
+  /**
+   * Returns ms the phase took to run, -1 until it's done.
+   */
+  int time_get() const;
+
+  const char* name;
+
+ private:
+  void run();
+
+  void (*work)();
+  BootPhase* after;
+  std::atomic<bool> finished{false};
+  std::atomic<int> took{-1};
+};
+
+/**
+ * Marks the start of startup, call this first thing in initialize().
+ */
+void boot_begin();
+
+/**
+ * Marks initialize() as done and prints how long it and every phase took.
+ */
+void boot_end();
+
+/**
+ * Returns ms initialize() took, -1 until it's done.
+ */
+int boot_time_get();
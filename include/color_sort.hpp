@@ -0,0 +1,40 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "color_sorter.hpp"
+
+// Optical sensor looking into the top conveyor stage.  Balls wait below the top stage while
+// intaking, so the top stage's encoder tracks a ball from the sensor to the eject point
+inline pros::Optical color_sensor(15);
+
+// Outtake power while ejecting, this throws the ball out the back instead of into a goal
+inline const int color_sort_eject_power = -127;
+
+// Color kept in driver control, set by the config file (0 keeps everything, 1 red, 2 blue).  Routes set their own
+inline int color_sort_alliance = BALL_NONE;
+
+/**
+ * Sets the sensor to its fastest update rate and turns the LED on.
+ */
+void color_sort_initialize();
+
+/**
+ * Sets the color to keep.  Balls of any other color get ejected, BALL_NONE turns sorting off.
+ */
+void color_sort_alliance_set(ball_color color);
+
+/**
+ * Forgets balls waiting to be ejected.  Run when the conveyor stops or reverses, since they won't reach the eject point.
+ */
+void color_sort_reset();
+
+/**
+ * Samples the sensor and returns true while the outtake should eject.  This is run by the subsystem task every tick.
+ */
+bool color_sort_iterate();
+
+/**
+ * Returns how many balls have been ejected.
+ */
+int color_sort_ejected_get();
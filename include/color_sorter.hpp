@@ -0,0 +1,90 @@
+#pragma once
+
+enum ball_color { BALL_NONE,
+                  BALL_RED,
+                  BALL_BLUE };
+
+/**
+ * Sorts balls by color as they pass an optical sensor on the conveyor.
+ *
+ * A ball is only classified while it's close to the sensor, and both the proximity and the hue
+ * have separate enter and exit thresholds so a reading sitting on a boundary can't flicker.
+ * When a ball of the wrong color is seen, an eject is scheduled at the belt position where that
+ * ball will reach the eject point.  The eject fires early by however far the belt moves during
+ * the actuator delay, so it lands on time no matter how fast the belt is running.
+ *
+ * Nothing in here talks to hardware, every input is passed in.
+ */
+class ColorSorter {
+ public:
+  struct Constants {
+    double red_hue = 10;            // hue of a red ball, 0 to 360
+    double blue_hue = 220;          // hue of a blue ball, 0 to 360
+    double enter_band = 25;         // degrees from a ball's hue to start calling it that color
+    double exit_band = 45;          // degrees from a ball's hue to stop calling it that color
+    int proximity_enter = 120;      // proximity above this means a ball is in front, 0 to 255
+    int proximity_exit = 80;        // proximity below this means the ball has left
+    double eject_distance = 7.0;    // in of belt from the sensor to the eject point
+    double eject_length = 3.0;      // in of belt travel to keep ejecting for
+    double actuator_delay = 40;     // ms from reading the sensor to the eject actually moving
+  };
+
+  ColorSorter();
+  ColorSorter(Constants constants);
+
+  /**
+   * Sets the color to keep.  Balls of any other color get ejected, BALL_NONE keeps everything.
+   */
+  void alliance_set(ball_color color);
+
+  /**
+   * Returns the color being kept.
+   */
+  ball_color alliance_get() const;
+
+  /**
+   * Feeds one sample and returns true while the eject should be running.
+   *
+   * \param hue
+   *        sensor hue, 0 to 360
+   * \param proximity
+   *        sensor proximity, 0 to 255
+   * \param position
+   *        belt position, in
+   * \param velocity
+   *        belt velocity, in/s
+   */
+  bool iterate(double hue, int proximity, double position, double velocity);
+
+  /**
+   * Returns the color of the ball in front of the sensor, BALL_NONE when there isn't one or it's unsure.
+   */
+  ball_color color_get() const;
+
+  /**
+   * Returns how many balls have been ejected.
+   */
+  int ejected_get() const;
+
+  /**
+   * Drops any scheduled ejects.
+   */
+  void reset();
+
+  Constants constants;
+
+ private:
+  static const int MAX_PENDING = 4;
+  ball_color classify(double hue, ball_color current) const;
+
+  ball_color alliance = BALL_NONE;
+  bool ball_present = false;
+  bool ball_scheduled = false;
+  ball_color current_color = BALL_NONE;
+  double pending[MAX_PENDING] = {};
+  int pending_head = 0;
+  int pending_count = 0;
+  double eject_end = 0;
+  bool ejecting = false;
+  int ejected = 0;
+};
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "config_store.hpp"
+
+// Constants can be changed without rebuilding by putting them in /usd/config.txt.  The file is read
+// once by the config boot phase, before default_constants() applies them, and the PID tuner writes its
+// constants back when it's turned off.  Bump CONFIG_VERSION whenever a setting changes meaning.
+
+inline const int CONFIG_VERSION = 1;
+
+struct exit_constants {
+  double small_time;     // ms
+  double small_error;    // in or deg
+  double big_time;       // ms
+  double big_error;      // in or deg
+  double velocity_time;  // ms
+  double mA_time;        // ms
+};
+
+struct slew_constants {
+  double distance;  // in or deg
+  double min_speed;
+};
+
+/**
+ * Everything default_constants() gives the chassis.  The defaults live in autons.cpp.
+ */
+struct robot_tuning {
+  // P, I, D, and Start I at NOMINAL_VOLTAGE, the gain schedule task scales them for the battery
+  ez::PID::Constants drive;
+  ez::PID::Constants heading;
+  ez::PID::Constants turn;
+  ez::PID::Constants swing;
+  ez::PID::Constants odom_angular;
+  ez::PID::Constants boomerang;
+  int turn_scheduled;  // 1 to take turn constants from turn_schedule, 0 to use turn
+
+  exit_constants turn_exit;
+  exit_constants swing_exit;
+  exit_constants drive_exit;
+  exit_constants odom_turn_exit;
+  exit_constants odom_drive_exit;
+  double turn_chain;   // deg
+  double swing_chain;  // deg
+  double drive_chain;  // in
+
+  slew_constants turn_slew;
+  slew_constants drive_slew;
+  slew_constants swing_slew;
+
+  double odom_turn_bias;
+  double odom_look_ahead;     // in
+  double boomerang_distance;  // in
+  double boomerang_dlead;
+};
+
+extern robot_tuning tuning;
+
+/**
+ * Loads /usd/config.txt over the defaults in one read.  Call this before default_constants().
+ */
+void config_load();
+
+/**
+ * Writes every setting to /usd/config.txt, returns true if it was saved.
+ */
+bool config_save();
+
+/**
+ * Copies the constants out of the PID tuner and saves them.  Turn constants that were changed
+ * replace turn_schedule, since the tuner edits one set of constants and not the table.
+ */
+void config_save_tuned();
+
+/**
+ * Turns the PID tuner on or off, and saves what was tuned when it's turned off.  Use this
+ * instead of chassis.pid_tuner_toggle() so the gain schedule can't overwrite the turn constants
+ * between the tuner letting go of them and them being saved.
+ */
+void config_tuner_toggle();
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Returns the FNV-1a hash of a key, usable at compile time.
+ */
+constexpr uint32_t config_hash(const char* key, size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) hash = (hash ^ (uint8_t)key[i]) * 16777619u;
+  return hash;
+}
+
+/**
+ * Settings stored as key=value text, one per line, with # comments.  The first key must be
+ * "version", and a file from a different version is ignored so renamed or rescaled settings are
+ * never loaded into the wrong place.
+ *
+ * Every setting is bound to a variable ahead of time.  The bindings are kept sorted by the hash of
+ * their key, so loading is one pass over the text with a binary search per line, and nothing is
+ * allocated.
+ *
+ * Nothing in here talks to hardware, every input is passed in.
+ */
+class ConfigStore {
+ public:
+  static const int KEYS_MAX = 96;
+
+  struct load_result {
+    int version;    // version the text says it is, -1 if it doesn't say or it isn't a whole number
+    bool accepted;  // false if the version didn't match and nothing was loaded
+    int loaded;     // settings loaded
+    int unknown;    // keys nothing is bound to, skipped
+    int bad;        // lines that aren't key=number, skipped
+  };
+
+  /**
+   * \param version
+   *        version written to and expected from the text, bump this when a setting changes meaning
+   */
+  ConfigStore(int version);
+
+  /**
+   * Binds a setting to a variable.  The key has to outlive the store.  Returns false when the
+   * store is full or the key is already bound.
+   */
+  bool add(const char* key, double* value);
+  bool add(const char* key, int* value);
+
+  /**
+   * Loads settings from text into their variables.
+   *
+   * \param text
+   *        null terminated
+   */
+  load_result parse(const char* text);
+
+  /**
+   * Writes the version and every setting, in the order they were bound.
+   *
+   * Returns the length written, not counting the null terminator, or 0 if it didn't fit.
+   */
+  size_t write(char* buffer, size_t size) const;
+
+  /**
+   * Returns the number of settings bound.
+   */
+  int count_get() const { return count; }
+
+ private:
+  struct binding {
+    uint32_t hash;
+    const char* key;
+    double* number;
+    int* integer;
+    int order;  // When it was bound, so write() keeps related settings together
+  };
+
+  bool bind(const char* key, double* number, int* integer);
+  const binding* find(const char* key, size_t length) const;
+
+  binding bindings[KEYS_MAX];
+  int count = 0;
+  int version;
+};
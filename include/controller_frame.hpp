@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+// Shared with the recording format, so it can't use anything from PROS.
+
+/**
+ * Everything opcontrol reads from the controller in one tick, plus the subsystem state when it was read.
+ */
+struct controller_frame {
+  int8_t axes[4] = {0, 0, 0, 0};  // Indexed by pros::controller_analog_e_t
+  uint16_t buttons = 0;           // Bit (button - DIGITAL_L1) for each pros::controller_digital_e_t
+  uint8_t state = 0;              // Subsystem state
+};
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "controller_frame.hpp"
+
+/**
+ * Reads the master controller into a frame.
+ */
+controller_frame controller_read();
+
+/**
+ * Sets the frame that opcontrol code reads this tick.  Call this once per tick, from the
+ * controller during driver control or from a recording during playback.
+ */
+void input_update(const controller_frame& frame);
+
+/**
+ * Returns the frame set by input_update().
+ */
+const controller_frame& input_get();
+
+// Drop in replacements for master.get_analog(), get_digital() and get_digital_new_press()
+int input_analog(pros::controller_analog_e_t channel);
+bool input_digital(pros::controller_digital_e_t button);
+bool input_digital_new_press(pros::controller_digital_e_t button);
+
+/**
+ * One tick of driver control, reading only from input_get().  Defined in main.cpp.
+ */
+void opcontrol_iterate();
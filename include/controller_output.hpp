@@ -0,0 +1,38 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "controller_queue.hpp"
+
+// Higher priority messages get sent first
+enum controller_priority { PRIORITY_LOW = 0,
+                           PRIORITY_NORMAL = 1,
+                           PRIORITY_HIGH = 2 };
+
+// ms between messages, the controller drops anything sent faster than about 50 ms
+inline int controller_send_time = 50;
+
+/**
+ * Queues a line of text for the controller screen, formatted like printf.  Never blocks.
+ *
+ * \param line
+ *        0 to 2
+ * \param priority
+ *        higher goes first
+ */
+void controller_print(int line, int priority, const char* format, ...) __attribute__((format(printf, 3, 4)));
+
+/**
+ * Queues a rumble pattern.  Never blocks.
+ *
+ * \param pattern
+ *        '.' short, '-' long and ' ' pause
+ * \param priority
+ *        higher goes first
+ */
+void controller_rumble(const char* pattern, int priority = PRIORITY_HIGH);
+
+/**
+ * Sends one queued message every controller_send_time.  This runs in its own task.
+ */
+void controller_task();
@@ -0,0 +1,64 @@
+#pragma once
+
+/**
+ * Holds what's waiting to be sent to the controller.
+ *
+ * The controller only takes one screen line or rumble about every 50 ms and silently drops
+ * anything sent faster.  There's one slot for each of the 3 screen lines and one for rumble, and
+ * writing to a slot that's still waiting replaces it, so only the newest text for a line is ever
+ * sent.  The highest priority slot goes first, and slots with the same priority go oldest first.
+ *
+ * Nothing in here talks to hardware.
+ */
+class ControllerQueue {
+ public:
+  static const int LINES = 3;
+  static const int RUMBLE = LINES;  // Slot used for rumble
+  static const int TEXT_SIZE = 20;  // The controller fits 19 characters on a line
+
+  struct message {
+    int slot;                // screen line, or RUMBLE
+    int priority;            // higher goes first
+    char text[TEXT_SIZE];    // line text or rumble pattern
+  };
+
+  /**
+   * Queues a screen line, replacing any text still waiting for it.
+   *
+   * \param line
+   *        0 to 2
+   * \param priority
+   *        higher goes first
+   * \param text
+   *        what to show, cut to fit
+   */
+  void text(int line, int priority, const char* text);
+
+  /**
+   * Queues a rumble pattern, replacing any pattern still waiting.
+   *
+   * \param priority
+   *        higher goes first
+   * \param pattern
+   *        '.' short, '-' long and ' ' pause
+   */
+  void rumble(int priority, const char* pattern);
+
+  /**
+   * Takes the next message to send, returns false when nothing is waiting.
+   */
+  bool pop(message& out);
+
+  /**
+   * Returns how many messages are waiting.
+   */
+  int pending_get() const;
+
+ private:
+  void queue(int slot, int priority, const char* text);
+
+  message slots[LINES + 1] = {};
+  bool waiting[LINES + 1] = {};
+  unsigned sequence[LINES + 1] = {};
+  unsigned next_sequence = 0;
+};
@@ -1,6 +1,38 @@
 #pragma once
 
-#include "main.h"
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "subsystem_motors.hpp"
 
+// Define the motors here
+inline SubsystemMotors bottom_conveyor({13}, "bottom conveyor");  // Define the bottom conveyor stage on port 13
+inline SubsystemMotors top_conveyor({14}, "top conveyor");        // Define the top conveyor stage on port 14
+
+// Belt geometry, used to turn balls per second into motor rpm
+inline const double conveyor_ball_spacing = 3.5;     // in of belt between balls
+inline const double conveyor_travel_per_rev = 6.0;  // in of belt per motor revolution
+
+// For middle goals
+inline double conveyor_slow_bps = 2.0;
+// For long goals
+inline double conveyor_fast_bps = 5.0;
+
+/**
+ * Converts balls per second to conveyor motor rpm.
+ */
+double conveyor_bps_to_rpm(double bps);
+
+// Open loop, -127 to 127.  Both stages unjam themselves when they stall, see jam_detector.hpp
 void set_bottom_conveyor(int input);
-void set_top_conveyor(int input);
\ No newline at end of file
+void set_top_conveyor(int input);
+
+/**
+ * Runs both stages closed loop so balls move at a constant rate no matter the load or battery.
+ *
+ * \param bps
+ *        balls per second, negative runs backwards
+ */
+void set_conveyor_throughput(double bps);
+
+// Returns how many jams both stages have cleared
+int conveyor_jams_get();
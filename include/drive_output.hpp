@@ -0,0 +1,40 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "voltage_scale.hpp"
+
+/**
+ * Voltage the compensated outputs are scaled to, in mV.  127 always means this much voltage
+ * at the motor, until the battery drops below it.
+ */
+inline int NOMINAL_VOLTAGE = 11500;
+
+/**
+ * Returns the low-pass filtered brain battery voltage, in mV.
+ */
+double battery_voltage_get();
+
+/**
+ * Updates the battery filter.  This runs in its own task every ez::util::DELAY_TIME.
+ */
+void battery_filter_iterate();
+
+/**
+ * Converts a -127 to 127 command into a move_voltage() command that produces the same
+ * voltage at the motor regardless of battery level.
+ *
+ * \param input
+ *        -127 to 127
+ */
+int voltage_compensate(double input);
+
+/**
+ * Sets the chassis with compensated voltage.  Motors in a PTO are skipped.
+ *
+ * \param left
+ *        -127 to 127
+ * \param right
+ *        -127 to 127
+ */
+void drive_output_set(double left, double right);
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+
+struct map_point {
+  int16_t x;
+  int16_t y;
+};
+
+/**
+ * Turns field coordinates into pixels on a square map.
+ *
+ * The field's center is (0, 0) with +y pointing up the screen, and points off the field are
+ * pinned to its edge so nothing is ever drawn outside the map.
+ */
+class FieldTransform {
+ public:
+  /**
+   * \param field_size
+   *        width of the field, in
+   * \param pixels
+   *        width of the map, px
+   */
+  FieldTransform(double field_size = 144.0, int pixels = 200);
+
+  /**
+   * Returns where a field point is on the map.
+   */
+  map_point to_pixel(double x, double y) const;
+
+  /**
+   * Returns pixels per inch.
+   */
+  double scale_get() const;
+
+ private:
+  double half_field;
+  int pixels;
+  double scale;
+};
+
+/**
+ * Drops trail points that wouldn't show up on the map.  A point is only kept once it's a few
+ * pixels from the last one kept, so a robot sitting still adds nothing to draw.
+ */
+class TrailDecimator {
+ public:
+  /**
+   * \param min_pixels
+   *        px a point has to move before it's kept
+   */
+  TrailDecimator(int min_pixels = 3);
+
+  /**
+   * Returns true when this point should be added to the trail.
+   */
+  bool keep(map_point point);
+
+  /**
+   * Starts a new trail, the next point is always kept.
+   */
+  void reset();
+
+ private:
+  int min_pixels;
+  bool started = false;
+  map_point last = {0, 0};
+};
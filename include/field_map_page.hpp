@@ -0,0 +1,20 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "field_map.hpp"
+
+// Most LVGL objects the map changes in one frame.  Each change makes LVGL redraw that object's
+// area, so this bounds how long a frame can take no matter how much moved
+inline int field_map_draw_budget = 4;
+
+/**
+ * Draws the field, the path from the last pid_odom_actions_set(), its look ahead point and a
+ * trail of where the robot has been.  Only what changed is touched.  This is run by the screen task.
+ */
+void field_map_draw();
+
+/**
+ * Hides the map, for when another page is showing.
+ */
+void field_map_hide();
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+// Flight recorder log format.  A log is a flight_log_header followed by header.count
+// flight_samples, oldest first, all little endian.  This is shared with tools/flight_decode.cpp,
+// so it can't use anything from PROS.
+
+inline const char FLIGHT_LOG_MAGIC[4] = {'F', 'L', 'O', 'G'};
+inline const uint8_t FLIGHT_LOG_VERSION = 1;
+
+// Why a log was written
+enum flight_reason : uint8_t {
+  FLIGHT_DISABLED = 1,  // The robot was disabled after running
+  FLIGHT_INTERFERED,    // EZ-Template noticed the drive was blocked
+  FLIGHT_LOW_BATTERY,   // Battery sagged far enough to brown out
+  FLIGHT_JAM,           // The conveyor jammed
+  FLIGHT_MANUAL,        // Asked for from code
+};
+
+// flight_sample.flags
+enum flight_flag : uint8_t {
+  FLIGHT_FLAG_ENABLED = 1 << 0,
+  FLIGHT_FLAG_AUTONOMOUS = 1 << 1,
+  FLIGHT_FLAG_INTERFERED = 1 << 2,
+};
+
+struct __attribute__((packed)) flight_log_header {
+  char magic[4];
+  uint8_t version;
+  uint8_t reason;  // flight_reason
+  uint8_t period;  // ms between samples
+  uint16_t count;  // samples that follow
+  uint32_t time;   // ms since the program started when this was written
+};
+
+struct __attribute__((packed)) flight_sample {
+  uint32_t time;  // ms since the program started
+
+  // Odometry
+  float x;      // in
+  float y;      // in
+  float theta;  // deg
+
+  // Drive
+  uint8_t drive_mode;      // ez::e_mode
+  int16_t left_voltage;    // mV the front motor on each side is being given
+  int16_t right_voltage;
+  int16_t left_current;    // mA
+  int16_t right_current;
+
+  // Subsystems
+  uint8_t subsystem_state;
+  int16_t intake_current;  // mA
+  int16_t bottom_current;
+  int16_t top_current;
+  int16_t outtake_current;
+
+  uint16_t battery;  // mV
+  uint8_t flags;     // flight_flag
+};
+
+/**
+ * Keeps the last SAMPLES samples, overwriting the oldest.  Everything is inline storage, so pushing
+ * never allocates.
+ */
+class FlightRing {
+ public:
+  static const int SAMPLES = 250;  // 5 s at 20 ms
+
+  /**
+   * Adds a sample, dropping the oldest one when full.
+   */
+  void push(const flight_sample& sample);
+
+  /**
+   * Returns the number of samples held.
+   */
+  int count_get() const { return count; }
+
+  /**
+   * Returns a sample, 0 is the oldest.
+   */
+  const flight_sample& at(int index) const;
+
+  /**
+   * Forgets every sample.
+   */
+  void clear();
+
+ private:
+  flight_sample samples[SAMPLES] = {};
+  int next = 0;
+  int count = 0;
+};
+
+/**
+ * Writes a whole log, returns true when every byte made it out.
+ *
+ * \param out
+ *        file to write to
+ * \param ring
+ *        samples to write
+ * \param reason
+ *        why this is being written
+ * \param period
+ *        ms between samples
+ * \param now
+ *        ms since the program started
+ */
+bool flight_log_write(FILE* out, const FlightRing& ring, flight_reason reason, int period, uint32_t now);
+
+/**
+ * Reads and checks a log header, returns false if it isn't one this version can read.
+ */
+bool flight_log_read_header(FILE* in, flight_log_header& header);
+
+/**
+ * Returns a name for a flight_reason.
+ */
+const char* flight_reason_to_string(uint8_t reason);
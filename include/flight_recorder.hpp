@@ -0,0 +1,33 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "flight_log.hpp"
+
+// ms between flight recorder samples, FlightRing::SAMPLES of these is how far back a log goes
+inline int flight_recorder_period = 20;
+
+// mV the battery can sag to before a log is written, the brain browns out not far below this
+inline int flight_low_battery = 9000;
+
+/**
+ * Asks the flight recorder to write the last few seconds to the SD card.  The write happens in the
+ * flight recorder's task, so this returns right away and is safe to call from anywhere.
+ * Nothing is written if the robot hasn't been enabled since the last log.
+ *
+ * \param reason
+ *        why the log is being written
+ */
+void flight_recorder_flush(flight_reason reason);
+
+/**
+ * Returns the number of logs written since the program started.
+ */
+int flight_recorder_logs_get();
+
+/**
+ * Samples the robot every flight_recorder_period, watches for faults, and writes logs to
+ * /usd/flightNN.bin, going back to flight00 after flight99.  Decode them with
+ * tools/flight_decode.cpp.  This runs in its own task.
+ */
+void flight_recorder_task();
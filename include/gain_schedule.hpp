@@ -0,0 +1,72 @@
+#pragma once
+
+#include <functional>
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "gain_table.hpp"
+
+// Table of ez::PID constants, see gain_table.hpp
+using GainSchedule = GainTable<ez::PID::Constants>;
+
+/**
+ * Schedules a PID's constants.
+ *
+ * The motion magnitude is captured whenever the PID's target changes, and constants are
+ * refreshed every tick so they follow the battery as it sags.  Adding the same PID again
+ * replaces its schedule.
+ *
+ * \param pid
+ *        the PID to write constants to
+ * \param schedule
+ *        the table to read constants from
+ * \param sensor
+ *        returns the current sensor value of the PID
+ */
+void gain_schedule_add(ez::PID* pid, const GainSchedule& schedule, std::function<double()> sensor);
+
+/**
+ * Compensates a PID for the battery.
+ *
+ * Every tick the PID's gains are set to base times NOMINAL_VOLTAGE / battery, so its output gives
+ * the motors the same voltage as the battery sags.  A PID is either scheduled or compensated,
+ * adding it here stops scheduling it.  The max speed of each autonomous motion is scaled the same
+ * way a tick after the motion starts, and again whenever the speed is changed during the motion.  Gain schedules carry their own voltage axis, so scheduled PIDs
+ * aren't compensated.
+ *
+ * \param pid
+ *        the PID to write constants to
+ * \param base
+ *        constants at NOMINAL_VOLTAGE, read every tick so changing them takes effect
+ */
+void gain_compensate_add(ez::PID* pid, const ez::PID::Constants* base);
+
+/**
+ * Returns what compensated gains are being multiplied by.  Dividing by this turns the constants
+ * a compensated PID is running back into its base.
+ */
+double gain_compensate_scale_get();
+
+/**
+ * Returns the max speed the running motion asked for and what it was scaled to, -1 before the
+ * first motion.
+ */
+int gain_compensate_speed_requested_get();
+int gain_compensate_speed_written_get();
+
+/**
+ * Stops scheduling or compensating a PID, its constants are left as they are.
+ */
+void gain_schedule_remove(ez::PID* pid);
+
+/**
+ * Enables / disables writing scheduled constants.  The PID tuner also pauses scheduling.  Once
+ * this returns false, no constants are being written.
+ */
+void gain_schedule_enable(bool enable);
+bool gain_schedule_enabled();
+
+/**
+ * Looks up and writes constants for every scheduled PID.
+ */
+void gain_schedule_iterate();
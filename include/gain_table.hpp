@@ -0,0 +1,83 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+/**
+ * Table of PID constants keyed by target magnitude and battery voltage.
+ *
+ * Breakpoints are evenly spaced between a min and max on each axis, so finding the cell
+ * is a divide instead of a search.  Constants are bilinearly interpolated between the
+ * four corners of the cell, and inputs outside the table are clamped to its edges.
+ *
+ * Constants is any aggregate of kp, ki, kd and start_i, so this doesn't need PROS and
+ * tools/gain_schedule_test.cpp can check it on the host.
+ */
+template <typename Constants>
+class GainTable {
+ public:
+  static constexpr int MAGNITUDES = 4;
+  static constexpr int VOLTAGES = 3;
+  using Table = std::array<std::array<Constants, VOLTAGES>, MAGNITUDES>;
+
+  /**
+   * \param magnitude_min
+   *        target magnitude of the first row
+   * \param magnitude_max
+   *        target magnitude of the last row
+   * \param voltage_min
+   *        battery voltage of the first column, in mV
+   * \param voltage_max
+   *        battery voltage of the last column, in mV
+   * \param table
+   *        constants, rows are magnitudes and columns are voltages
+   */
+  GainTable(double magnitude_min, double magnitude_max, double voltage_min, double voltage_max, Table table)
+      : magnitude_min(magnitude_min),
+        magnitude_step((magnitude_max - magnitude_min) / (MAGNITUDES - 1)),
+        voltage_min(voltage_min),
+        voltage_step((voltage_max - voltage_min) / (VOLTAGES - 1)),
+        table(table) {}
+
+  /**
+   * Returns the interpolated constants.
+   *
+   * \param magnitude
+   *        size of the motion, in the units of the PID
+   * \param voltage
+   *        battery voltage in mV
+   */
+  Constants get(double magnitude, double voltage) const {
+    int m, v;
+    double tm, tv;
+    cell_find(std::fabs(magnitude), magnitude_min, magnitude_step, MAGNITUDES, m, tm);
+    cell_find(voltage, voltage_min, voltage_step, VOLTAGES, v, tv);
+
+    Constants low = lerp(table[m][v], table[m][v + 1], tv);
+    Constants high = lerp(table[m + 1][v], table[m + 1][v + 1], tv);
+    return lerp(low, high, tm);
+  }
+
+ private:
+  // Finds the cell an input falls in and how far across it the input is
+  static void cell_find(double input, double min, double step, int cells, int& index, double& t) {
+    double position = step > 0 ? (input - min) / step : 0.0;
+    position = std::clamp(position, 0.0, (double)(cells - 1));
+    index = std::min((int)position, cells - 2);
+    t = position - index;
+  }
+
+  static Constants lerp(const Constants& a, const Constants& b, double t) {
+    return {a.kp + (b.kp - a.kp) * t,
+            a.ki + (b.ki - a.ki) * t,
+            a.kd + (b.kd - a.kd) * t,
+            a.start_i + (b.start_i - a.start_i) * t};
+  }
+
+  double magnitude_min;
+  double magnitude_step;
+  double voltage_min;
+  double voltage_step;
+  Table table;
+};
@@ -1,14 +1,12 @@
-#pragma
+#pragma once
 
 #include "EZ-Template/api.hpp"
 #include "api.h"
+#include "subsystem_motors.hpp"
 
 // Define the motors here
-inline pros::Motor left_intake(11); // Define a motor intake on port 11
-inline pros::Motor right_intake(12); // Define a motor intake on port 12
+inline SubsystemMotors intake_motors({17, 12}, "intake");  // Intake motors on ports 17 and 12, port 11 is the IMU
 
-inline void set_intake_speed(pros::Motor& intake, int input);
+void set_intake_speed(int input);
 
-inline void stop_intake(pros::Motor& intake);
-
-void intake_opcontrol();
\ No newline at end of file
+void stop_intake();
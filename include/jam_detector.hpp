@@ -0,0 +1,60 @@
+#pragma once
+
+/**
+ * Detects a stalled motor and runs a short reverse-then-resume sequence.
+ *
+ * A motor is stalling when it's being asked for real power but isn't moving and is pulling
+ * a lot of current.  Once that lasts for the whole window, the output is reversed for a
+ * moment, then the commanded power is given back with detection paused so it can spin up.
+ */
+class JamDetector {
+ public:
+  struct Constants {
+    int window = 150;               // ms of stall before it counts as a jam
+    double min_power = 30;          // |command| below this never counts as a stall, -127 to 127
+    double stall_velocity = 10;     // |rpm| below this is stopped
+    double stall_current = 1800;    // mA above this is straining
+    int reverse_time = 150;         // ms to run backwards
+    double reverse_power = 100;     // power to run backwards at, 0 to 127
+    int recover_time = 250;         // ms after reversing before detecting again
+  };
+
+  JamDetector();
+  JamDetector(Constants constants);
+
+  /**
+   * Feeds one tick of motor data and returns the power to send to the motor.
+   *
+   * \param command
+   *        power the mechanism wants, -127 to 127
+   * \param velocity
+   *        measured velocity, rpm
+   * \param current
+   *        measured current, mA
+   * \param now
+   *        current time, ms
+   */
+  double iterate(double command, double velocity, double current, int now);
+
+  /**
+   * Returns true while the unjam sequence is running.
+   */
+  bool unjamming() const;
+
+  /**
+   * Returns how many jams have been cleared.
+   */
+  int jams_get() const;
+
+  Constants constants;
+
+ private:
+  enum phase { RUNNING,
+               REVERSING,
+               RECOVERING };
+  phase current_phase = RUNNING;
+  int stall_start = -1;
+  int phase_end = 0;
+  double jam_direction = 0;
+  int jams = 0;
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+
+/**
+ * The 5225A In the Zone curve used by EZ-Template.  0 scale is linear.
+ *
+ * \param x
+ *        joystick input, -127 to 127
+ * \param scale
+ *        curve scale
+ */
+inline double joystick_curve(double x, double scale) {
+  if (scale == 0) return x;
+  double low = std::pow(2.718, -(scale / 10.0));
+  return (low + std::pow(2.718, (std::fabs(x) - 127.0) / 10.0) * (1.0 - low)) * x;
+}
+
+/**
+ * joystick_curve() precomputed for every joystick value.
+ *
+ * Joysticks only report -127 to 127, so the table is rebuilt when the scale changes
+ * and each opcontrol tick is an array index instead of two exponentials.
+ */
+class CurveTable {
+ public:
+  CurveTable(double scale = 0.0) { scale_set(scale); }
+
+  /**
+   * Rebuilds the table if the scale changed.
+   */
+  void scale_set(double input) {
+    if (built && input == scale) return;
+    scale = input;
+    for (int i = 0; i < 256; i++) table[i] = joystick_curve(i - 128, scale);
+    built = true;
+  }
+
+  double scale_get() const { return scale; }
+
+  /**
+   * Returns the curved joystick value.
+   */
+  double get(int x) const {
+    if (x < -128) x = -128;
+    if (x > 127) x = 127;
+    return table[x + 128];
+  }
+
+ private:
+  std::array<float, 256> table;
+  double scale = 0.0;
+  bool built = false;
+};
+
+/**
+ * Curves used by drive_opcontrol_tank() and drive_opcontrol_arcade().  Tank only uses the left curve.
+ */
+inline CurveTable left_curve;
+inline CurveTable right_curve;
+
+/**
+ * Changes the curves with the buttons set in chassis.opcontrol_curve_buttons_left_set() and
+ * chassis.opcontrol_curve_buttons_right_set(), when chassis.opcontrol_curve_buttons_toggle() is on.
+ */
+void joystick_curve_buttons_iterate();
@@ -0,0 +1,77 @@
+#pragma once
+
+/**
+ * Decides when the robot is done loading balls from the match loader.
+ *
+ * Balls are counted two ways, by the intake's entry sensor and by the current bump the intake
+ * motors take every time they grab a ball, and the higher count wins so one missed reading
+ * doesn't stall the routine.  Loading is done when enough balls came in or the robot is full,
+ * when nothing has come in for a while because the loader is empty, or when it times out.
+ *
+ * Nothing in here talks to hardware, every input is passed in.
+ */
+class LoadMonitor {
+ public:
+  struct Constants {
+    double current_enter = 1500;  // mA above this is the intake grabbing a ball
+    double current_exit = 1000;   // mA below this is the intake running free again
+    int dry_time = 1000;          // ms without a new ball before the loader counts as empty
+    int spin_up_time = 100;       // ms after starting to ignore current, the intake's inrush isn't a ball
+  };
+
+  enum result { LOADING,
+                FILLED,
+                DRY,
+                TIMED_OUT };
+
+  LoadMonitor();
+  LoadMonitor(Constants constants);
+
+  /**
+   * Starts watching for balls.
+   *
+   * \param target
+   *        balls to load
+   * \param timeout
+   *        ms to give up after
+   * \param now
+   *        current time, ms
+   */
+  void start(int target, int timeout, int now);
+
+  /**
+   * Feeds one tick and returns true when loading is done.
+   *
+   * \param entered
+   *        balls the entry sensor has seen since start
+   * \param current
+   *        intake current, mA
+   * \param full
+   *        true when the robot can't hold any more
+   * \param now
+   *        current time, ms
+   */
+  bool iterate(int entered, double current, bool full, int now);
+
+  /**
+   * Returns how many balls have been loaded.
+   */
+  int loaded_get() const;
+
+  /**
+   * Returns why loading finished, or LOADING while it's still going.
+   */
+  result result_get() const;
+
+  Constants constants;
+
+ private:
+  int target = 0;
+  int start_time = 0;
+  int end_time = 0;
+  int last_ball_time = 0;
+  int loaded = 0;
+  int current_count = 0;
+  bool grabbing = false;
+  result current_result = LOADING;
+};
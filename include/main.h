@@ -46,9 +46,51 @@
 // More includes here...
 #include "autons.hpp"
 #include "subsystems.hpp"
+#include "subsystem_motors.hpp"
 #include "intake.hpp"
-// #include "outtake.hpp"
+#include "outtake_profile.hpp"
+#include "outtake.hpp"
+#include "jam_detector.hpp"
+#include "velocity_loop.hpp"
+#include "velocity_controller.hpp"
 #include "conveyor.hpp"
+#include "color_sorter.hpp"
+#include "color_sort.hpp"
+#include "ball_queue.hpp"
+#include "ball_tracking.hpp"
+#include "air_budget.hpp"
+#include "pneumatics.hpp"
+#include "load_monitor.hpp"
+#include "path_progress.hpp"
+#include "path_actions.hpp"
+#include "path_generator.hpp"
+#include "path_plans.hpp"
+#include "gain_table.hpp"
+#include "gain_schedule.hpp"
+#include "voltage_scale.hpp"
+#include "drive_output.hpp"
+#include "joystick_curve.hpp"
+#include "opcontrol_drive.hpp"
+#include "controller_frame.hpp"
+#include "controller_input.hpp"
+#include "controller_queue.hpp"
+#include "controller_output.hpp"
+#include "recording_format.hpp"
+#include "recorder.hpp"
+#include "speed_config.hpp"
+#include "subsystem_control.hpp"
+#include "screen.hpp"
+#include "field_map.hpp"
+#include "field_map_page.hpp"
+#include "telemetry_format.hpp"
+#include "telemetry.hpp"
+#include "task_profiler.hpp"
+#include "timing.hpp"
+#include "flight_log.hpp"
+#include "flight_recorder.hpp"
+#include "boot.hpp"
+#include "config_store.hpp"
+#include "config.hpp"
 // #include "color_detection.hpp"
 
 /**
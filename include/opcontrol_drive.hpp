@@ -0,0 +1,22 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+
+// These replace chassis.opcontrol_tank() and chassis.opcontrol_arcade_standard() so driver
+// control goes through drive_output_set() and gets voltage compensation.  Curves come from the
+// precomputed tables in joystick_curve.hpp.  Joystick threshold, curve buttons, drive reverse and
+// the opcontrol speed limit all still come from chassis.  Sticks are read from input_get().
+
+/**
+ * Tank control.
+ */
+void drive_opcontrol_tank();
+
+/**
+ * Standard arcade control.
+ *
+ * \param stick_type
+ *        ez::SPLIT or ez::SINGLE
+ */
+void drive_opcontrol_arcade(ez::e_type stick_type);
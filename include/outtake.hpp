@@ -1,12 +1,55 @@
-#pragma
+#pragma once
 
 #include "EZ-Template/api.hpp"
 #include "api.h"
+#include "outtake_profile.hpp"
+#include "subsystem_motors.hpp"
 
 // Define the motors here
 
-inline pros::Motor outtake(10);
+inline SubsystemMotors outtake({18}, "outtake");  // Outtake motor on port 18, port 10 is the right chassis
+
+enum goal_type { LONG_GOAL,
+                 MIDDLE_GOAL };
+
+// Outtake speeds balls should leave at, rpm.  The outtake can't hold its 200 rpm free speed with
+// balls going through it, so the long goal speed leaves room for the loop to correct
+inline double outtake_long_goal_rpm = 175;
+inline double outtake_middle_goal_rpm = 95;
 
 void set_outtake(int input);
 
-void outtake_opcontrol();
\ No newline at end of file
+/**
+ * Runs the outtake closed loop.
+ *
+ * \param rpm
+ *        target velocity
+ */
+void set_outtake_velocity(double rpm);
+
+/**
+ * Spins the outtake up on the way to a goal so it's at speed when the robot gets there.
+ * Call this before the motion, scoring at the goal takes over from it.
+ *
+ * \param goal
+ *        type of goal, this picks the speed
+ * \param x
+ *        where the robot will score from, in
+ * \param y
+ *        where the robot will score from, in
+ */
+void outtake_approach(goal_type goal, double x, double y);
+
+/**
+ * Stops spinning up for a goal.
+ */
+void outtake_approach_cancel();
+
+/**
+ * Runs the outtake while approaching a goal, returns true when it's spinning it up.  This is run by the subsystem task every tick.
+ */
+bool outtake_approach_iterate();
+
+void score();
+
+void score_slow();
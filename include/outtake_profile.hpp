@@ -0,0 +1,49 @@
+#pragma once
+
+/**
+ * Decides when to start spinning the outtake up on the way to a goal.
+ *
+ * The outtake needs (target - current) / acceleration seconds to get to speed, and the robot
+ * gets to the goal in distance / closing speed seconds.  Spinning up starts once the second is
+ * no longer than the first plus a margin, so the outtake is at speed the moment the robot stops.
+ *
+ * Nothing in here talks to hardware, every input is passed in.
+ */
+class OuttakeProfile {
+ public:
+  struct Constants {
+    double acceleration = 1000;      // rpm/s the outtake spins up at
+    double margin = 0.1;             // s to be at speed before arriving
+    double arrive_distance = 3.0;    // in from the goal to start no matter how fast the robot's going
+    double min_closing_speed = 2.0;  // in/s below which the robot isn't getting closer
+  };
+
+  OuttakeProfile();
+  OuttakeProfile(Constants constants);
+
+  /**
+   * Returns how long the outtake takes to get to a speed, s.
+   *
+   * \param target
+   *        speed to get to, rpm
+   * \param current
+   *        speed now, rpm
+   */
+  double spin_up_time(double target, double current) const;
+
+  /**
+   * Returns true once the outtake should start spinning up.
+   *
+   * \param target
+   *        speed to get to, rpm
+   * \param current
+   *        speed now, rpm
+   * \param distance
+   *        in from the goal
+   * \param closing_speed
+   *        in/s the robot is getting closer at
+   */
+  bool should_start(double target, double current, double distance, double closing_speed) const;
+
+  Constants constants;
+};
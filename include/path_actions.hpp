@@ -0,0 +1,91 @@
+#pragma once
+
+#include <functional>
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "path_progress.hpp"
+
+/**
+ * Something to run once the robot gets far enough along a path.
+ */
+struct path_action {
+  int index;                     // waypoint to run at, -1 to use distance instead
+  double distance;               // in along the path, or past the waypoint when index isn't -1
+  std::function<void()> action;  // runs in the subsystem task, so keep it quick
+};
+
+/**
+ * Runs an action once the robot passes a waypoint.
+ *
+ * \param index
+ *        waypoint in the path, the same index pid_wait_until_index() takes
+ * \param action
+ *        what to run
+ * \param offset
+ *        in past the waypoint to wait, negative runs before it
+ */
+path_action at_index(int index, std::function<void()> action, double offset = 0.0);
+
+/**
+ * Runs an action once the robot is a distance along the path.
+ *
+ * \param distance
+ *        in along the path from where the robot started
+ * \param action
+ *        what to run
+ */
+path_action at_distance(double distance, std::function<void()> action);
+
+/**
+ * Starts an odom motion and runs actions as the robot gets to them, without blocking the auton.
+ *
+ * \param path
+ *        points to go through, the same as pid_odom_set()
+ * \param actions
+ *        actions to run along the way
+ * \param slew_on
+ *        ramp up from a lower speed
+ */
+void pid_odom_actions_set(std::vector<ez::united_odom> path, std::vector<path_action> actions, bool slew_on = false);
+
+/**
+ * Sets actions to run along a motion that's already been started.  pid_odom_actions_set() does
+ * this for you.
+ *
+ * \param path
+ *        points the motion goes through, the same as pid_odom_set()
+ * \param actions
+ *        what to run and where, from at_index() and at_distance()
+ */
+void path_actions_set(std::vector<ez::united_odom> path, std::vector<path_action> actions);
+
+/**
+ * Drops any actions that haven't run yet.
+ */
+void path_actions_clear();
+
+/**
+ * Copies the path from the last pid_odom_actions_set() and returns how many points were copied.
+ *
+ * \param points
+ *        where to copy to
+ * \param max
+ *        most points that fit
+ */
+int path_points_get(path_point* points, int max);
+
+/**
+ * Returns a number that changes every time a new path is set.
+ */
+int path_version_get();
+
+/**
+ * Returns the point on the path one look ahead distance past the robot.
+ */
+path_point path_lookahead_get();
+
+/**
+ * Runs actions the robot has just passed.  This is run by the subsystem task every tick.
+ */
+void path_actions_iterate();
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+
+#include "path_progress.hpp"
+
+/**
+ * A point of a generated path, and which waypoint the robot is heading to while it's on it.
+ */
+struct generated_point {
+  path_point point;
+  int waypoint;  // Index into the waypoints given to path_inject(), never 0
+};
+
+/**
+ * Fills in points every spacing along straight lines between waypoints, the same way
+ * EZ-Template does before pure pursuit.  The first waypoint is where the robot starts and isn't
+ * part of the output, the last one always is.
+ *
+ * Nothing in here talks to hardware, every input is passed in.
+ *
+ * \param waypoints
+ *        where the robot starts, then every point it goes through
+ * \param spacing
+ *        in between generated points
+ * \param path
+ *        cleared, then filled with the generated points
+ */
+void path_inject(const std::vector<path_point>& waypoints, double spacing, std::vector<generated_point>& path);
+
+/**
+ * Smooths a generated path by pulling each point toward its neighbours, while keeping it near
+ * where it started, until a pass moves every point less than tolerance in total.  The start and
+ * the last point don't move.
+ *
+ * \param start
+ *        where the robot starts, the first waypoint given to path_inject()
+ * \param path
+ *        points from path_inject(), smoothed in place
+ * \param weight_smooth
+ *        how strongly points are pulled toward their neighbours
+ * \param weight_data
+ *        how strongly points are pulled back to where they started
+ * \param tolerance
+ *        total movement in a pass, in, that counts as done
+ * \param max_passes
+ *        gives up after this many passes
+ *
+ * Returns the number of passes it took.
+ */
+int path_smooth(path_point start, std::vector<generated_point>& path, double weight_smooth, double weight_data,
+                double tolerance, int max_passes = 1000);
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "path_generator.hpp"
+
+// in the robot can be from a plan's start and still use its generated path
+inline double path_plan_start_tolerance = 2.0;
+
+/**
+ * A multi point motion a route will run, registered ahead of time so its path can be injected and
+ * smoothed while the robot waits for the match instead of when the motion starts.
+ *
+ * Run it with pid_odom_actions_set().  Once generated, the motion is started with the finished
+ * points through pid_odom_pp_set(), so pid_wait_until_index() counts generated points, use
+ * at_index() instead.  The generated path starts from start, so it's only used when the robot is
+ * within path_plan_start_tolerance of it, otherwise EZ-Template injects the path from where the
+ * robot really is.  Paths with a boomerang angle on a point are left to EZ-Template.
+ */
+class PathPlan {
+ public:
+  /**
+   * \param route
+   *        the auton this motion belongs to, its plans are generated when it's selected
+   * \param start
+   *        where the robot will be when the motion starts
+   * \param path
+   *        points to go through after start, the same as pid_odom_set()
+   */
+  template <typename... Args>
+  PathPlan(void (*route)(Args...), ez::united_pose start, std::vector<ez::united_odom> path)
+      : route((const void*)route), start(start), path(path) {
+    plan_register();
+  }
+
+  /**
+   * Injects and smooths the path with the chassis's current spacing and smoothing constants.
+   */
+  void generate();
+
+  /**
+   * Throws away the generated path.
+   */
+  void release();
+
+  /**
+   * Returns true once the path is generated.
+   */
+  bool ready() const { return generated; }
+
+  /**
+   * Returns the generated path, only valid while ready().
+   */
+  const std::vector<ez::odom>& movements_get() const { return movements; }
+
+  const void* route;
+  const ez::united_pose start;
+  const std::vector<ez::united_odom> path;
+
+ private:
+  void plan_register();
+
+  std::vector<ez::odom> movements;
+  std::vector<generated_point> points;
+  std::atomic<bool> generated{false};
+};
+
+/**
+ * Runs a planned motion with actions along it, the same as the other pid_odom_actions_set().
+ * If the path hasn't been generated yet, or the robot isn't near the plan's start, EZ-Template
+ * injects it now from where the robot is.
+ */
+void pid_odom_actions_set(PathPlan& plan, std::vector<path_action> actions, bool slew_on = false);
+
+/**
+ * Generates the paths of the auton picked in the selector and throws away the rest.  If the
+ * selected auton isn't a plain function, like a lambda, every path is generated.
+ */
+void path_plans_generate();
+
+/**
+ * Returns the us the last path_plans_generate() took.
+ */
+int path_plans_time_get();
+
+/**
+ * Generates paths again whenever a different auton is selected, after the first
+ * path_plans_generate().  This only does anything while the robot is disabled, and runs in its
+ * own task.
+ */
+void path_plans_task();
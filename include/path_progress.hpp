@@ -0,0 +1,66 @@
+#pragma once
+
+#include <vector>
+
+struct path_point {
+  double x;
+  double y;
+};
+
+/**
+ * Tracks how far along a path of straight segments the robot is.
+ *
+ * The robot's position is projected onto the segment it's on or one of the next two, so
+ * progress only ever moves forward and a path that crosses itself doesn't jump ahead.
+ *
+ * Nothing in here talks to hardware, every input is passed in.
+ */
+class PathProgress {
+ public:
+  /**
+   * Starts a new path.  This allocates, so call it when the path is set and not every tick.
+   *
+   * \param points
+   *        path to follow, starting with where the robot is now
+   */
+  void set(std::vector<path_point> points);
+
+  /**
+   * Updates progress with the robot's position and returns it, in along the path.
+   */
+  double update(double x, double y);
+
+  /**
+   * Returns how far along the path a point is, in.
+   */
+  double point_distance(int index) const;
+
+  /**
+   * Returns the point a distance along the path.
+   *
+   * \param distance
+   *        in along the path, clamped to the path
+   */
+  path_point point_at(double distance) const;
+
+  /**
+   * Returns the length of the path, in.
+   */
+  double length_get() const;
+
+  /**
+   * Returns the last progress from update(), in.
+   */
+  double progress_get() const;
+
+  /**
+   * Returns the points of the path.
+   */
+  const std::vector<path_point>& points_get() const;
+
+ private:
+  std::vector<path_point> points;
+  std::vector<double> distances;  // Distance along the path to each point
+  int segment = 0;
+  double progress = 0;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "air_budget.hpp"
+#include "api.h"
+
+/**
+ * An ez::Piston that keeps track of the air it uses.
+ */
+class TrackedPiston {
+ public:
+  /**
+   * \param port
+   *        ADI port of the solenoid, 'A' to 'H'
+   * \param tank
+   *        tank this piston draws from
+   * \param cylinder
+   *        size of the cylinder
+   * \param default_state
+   *        reverses the solenoid
+   */
+  TrackedPiston(int port, AirTank& tank, Cylinder cylinder, bool default_state = false);
+
+  /**
+   * Sets the piston, using air when this changes its state.
+   */
+  void set(bool input);
+
+  /**
+   * Returns the current piston state.
+   */
+  bool get();
+
+  /**
+   * Toggles the piston on a new press of the button, see ez::Piston::button_toggle.
+   */
+  void button_toggle(int toggle);
+
+  /**
+   * Returns how many times this piston has moved.
+   */
+  int actuations_get() const;
+
+  /**
+   * Returns how much air this piston has used, in^3 at atmospheric pressure.
+   */
+  double air_used_get() const;
+
+  /**
+   * Returns how many more times this piston can move before the tank is too low, assuming nothing else uses air.
+   */
+  int actuations_left();
+
+  ez::Piston piston;
+  Cylinder cylinder;
+
+ private:
+  void actuated(bool extended);
+
+  AirTank& tank;
+  int actuations = 0;
+  double air_used = 0.0;
+};
+
+inline AirTank air_tank;
+
+// Scraper that pulls balls out of the match loader, a 50 mm stroke single acting cylinder
+inline TrackedPiston scraper('A', air_tank, {0.39, 1.97, 0.0, false, 0.3});
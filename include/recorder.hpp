@@ -0,0 +1,26 @@
+#pragma once
+
+#include "controller_input.hpp"
+#include "recording_format.hpp"
+
+/**
+ * Starts recording opcontrol into RAM.
+ */
+void recording_start();
+
+/**
+ * Stops recording and saves it to the SD card.
+ */
+void recording_stop();
+
+bool recording_active();
+
+/**
+ * Records this tick's frame if a recording is running.  Call this once per opcontrol tick.
+ */
+void recording_iterate(const controller_frame& frame);
+
+/**
+ * Autonomous routine that plays the saved recording through opcontrol_iterate().
+ */
+void recording_play();
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "controller_frame.hpp"
+
+// Recording format:
+//   header:  "EZRC", version, tick length in ms
+//   record:  change mask, tick delta (varint), then for every set bit in the mask:
+//              bits 0-3: axis change (zigzag varint)
+//              bit 4:    buttons XOR the last buttons (varint)
+//              bit 5:    subsystem state (1 byte)
+//   end:     RECORDING_END as the mask
+// A record is only written on ticks where the frame changed, so a still controller costs nothing.
+// This doesn't use anything from PROS so tools/recording_test.cpp can check it on the host.
+
+inline const uint8_t RECORDING_VERSION = 1;
+inline const uint8_t RECORDING_END = 0xFF;
+inline const size_t RECORDING_HEADER_SIZE = 6;
+
+/**
+ * Delta encodes controller frames into a fixed buffer.
+ */
+class RecordingEncoder {
+ public:
+  /**
+   * \param buffer
+   *        where to write, the header goes in right away
+   * \param capacity
+   *        bytes in buffer
+   * \param tick_length
+   *        ms per tick, saved in the header
+   */
+  RecordingEncoder(uint8_t* buffer, size_t capacity, uint8_t tick_length);
+
+  /**
+   * Adds the frame seen on this tick.  Returns false once the buffer is full.
+   *
+   * \param tick
+   *        ticks since the recording started, never decreasing
+   */
+  bool add(uint32_t tick, const controller_frame& frame);
+
+  /**
+   * Writes the end marker and returns the total size in bytes.
+   */
+  size_t finish();
+
+ private:
+  bool put(uint8_t byte);
+  bool put_varint(uint32_t value);
+  uint8_t* buffer;
+  size_t capacity;
+  size_t length = 0;
+  uint32_t last_tick = 0;
+  controller_frame last;
+};
+
+/**
+ * Reads records back out of a buffer written by RecordingEncoder.
+ */
+class RecordingDecoder {
+ public:
+  RecordingDecoder(const uint8_t* buffer, size_t length);
+
+  /**
+   * Returns false if the header is wrong.
+   */
+  bool valid() const;
+
+  /**
+   * Returns the frame for a tick.  Ticks must be asked for in order.  Records that were
+   * due on skipped ticks are all applied, so a late tick catches back up.
+   */
+  const controller_frame& at(uint32_t tick);
+
+  /**
+   * Returns true once the end marker has been read.
+   */
+  bool done() const;
+
+ private:
+  bool next();
+  uint32_t get_varint();
+  const uint8_t* buffer;
+  size_t length;
+  size_t position = RECORDING_HEADER_SIZE;
+  bool has_pending = false;
+  uint32_t next_tick = 0;
+  controller_frame pending;
+  controller_frame current;
+};
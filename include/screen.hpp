@@ -0,0 +1,64 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+
+// How often the debug pages redraw, ms
+inline int screen_refresh_time = 50;
+
+/**
+ * The brain screen's 8 lines, formatted into fixed buffers so drawing a page never allocates.
+ *
+ * Lines are formatted every refresh but only sent to the screen when their text changed.
+ */
+class ScreenLines {
+ public:
+  static const int LINES = 8;
+  static const int WIDTH = 48;
+
+  /**
+   * Formats a line like printf.
+   *
+   * \param line
+   *        0 to 7
+   */
+  void print(int line, const char* format, ...) __attribute__((format(printf, 3, 4)));
+
+  /**
+   * Blanks a line.
+   */
+  void clear(int line);
+
+  /**
+   * Sends every line that changed to the screen, and returns how many were sent.
+   *
+   * \param first_line
+   *        lines above this belong to something else and are never sent
+   */
+  int draw(int first_line = 0);
+
+  /**
+   * Forgets what's on the screen so the next draw sends every line, for after a page change.
+   */
+  void invalidate();
+
+ private:
+  char next[LINES][WIDTH] = {};
+  char shown[LINES][WIDTH] = {};
+  bool valid[LINES] = {};
+};
+
+/**
+ * Draws the debug pages.  This runs in its own task.
+ */
+void ez_screen_task();
+
+/**
+ * Returns the average time one screen refresh takes, microseconds.
+ */
+int screen_task_micros_get();
+
+/**
+ * Returns the longest time one screen refresh has taken, microseconds.
+ */
+int screen_task_micros_max_get();
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "speed_config.hpp"
+
+// The subsystem task is the only thing that writes to the intake, conveyor and outtake motors.
+// Opcontrol and autons request a state with set_current_state(), and the task applies the newest
+// request on its next tick by looking the motor outputs up in a table.
+
+/**
+ * Motor outputs for every state, -127 to 127.  When conveyor_bps isn't 0 the conveyor runs
+ * closed loop at that many balls per second instead of the open loop stage outputs, and when
+ * outtake_rpm isn't 0 the outtake runs closed loop at that speed.
+ */
+struct state_outputs {
+  int intake;
+  int bottom_conveyor;
+  int top_conveyor;
+  int outtake;
+  double conveyor_bps;
+  double outtake_rpm;
+};
+
+/**
+ * Posts a request to the subsystem task.  Lock free and safe from any task; the newest request wins.
+ *
+ * \param new_state
+ *        state to switch to
+ * \param speed
+ *        0 to 127, scales every output of the state
+ */
+void subsystem_post(state new_state, int speed);
+
+/**
+ * Driver control for every subsystem.  R1 scores, R2 scores slowly, L1 intakes and L2 outtakes.
+ */
+void subsystem_opcontrol();
+
+/**
+ * Copies conveyor_*_bps and outtake_*_goal_rpm into the state table, call this after changing them.
+ */
+void subsystem_speeds_update();
+
+/**
+ * Applies pending requests and writes the motors.  This is run by the subsystem task every tick.
+ */
+void subsystem_iterate();
+
+/**
+ * Returns the state the subsystem task is applying.
+ */
+state subsystem_state_get();
+
+/**
+ * Returns how long the applied state has been running, in ms.
+ */
+int subsystem_state_time_get();
+
+/**
+ * Returns how long the last subsystem tick took, in microseconds.
+ */
+int subsystem_loop_time_get();
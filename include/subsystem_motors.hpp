@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <initializer_list>
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+
+/**
+ * Motors that always run together, like both sides of an intake.
+ *
+ * Every member is commanded with one call, and velocity, current and position are read once a
+ * tick by subsystem_motors_update() so everything else in the tick uses the same numbers without
+ * going back to the devices.  Every group registers itself so its ports can be checked against
+ * the chassis before a match.  A group isn't driven until subsystem_ports_validate() has checked
+ * it, and a group with a port that clashes is never driven, since it would fight whatever else is
+ * on that port.
+ */
+class SubsystemMotors {
+ public:
+  /**
+   * \param ports
+   *        motor ports, negative reverses the motor
+   * \param name
+   *        name printed when a port clashes
+   */
+  SubsystemMotors(std::initializer_list<std::int8_t> ports, const char* name);
+
+  /**
+   * Runs every motor with battery compensation.  Does nothing while the group is disabled.
+   *
+   * \param input
+   *        -127 to 127
+   */
+  void move(double input);
+
+  /**
+   * Reads telemetry from every motor.
+   */
+  void update();
+
+  /**
+   * Returns the average velocity from the last update, rpm.
+   */
+  double velocity_get() const;
+
+  /**
+   * Returns the total current from the last update, mA.
+   */
+  double current_get() const;
+
+  /**
+   * Returns the average position from the last update, degrees.
+   */
+  double position_get() const;
+
+  /**
+   * Returns true once the group's ports have been checked and none of them clash.
+   */
+  bool enabled_get() const;
+
+  const char* name;
+  pros::MotorGroup motors;
+
+ private:
+  friend int subsystem_ports_validate();
+  std::atomic<bool> enabled{false};
+
+  double velocity = 0.0;
+  double current = 0.0;
+  double position = 0.0;
+};
+
+/**
+ * Reads telemetry from every subsystem motor group.  This is run by the subsystem task at the start of every tick.
+ */
+void subsystem_motors_update();
+
+/**
+ * Checks that no two devices share a port, across the chassis, the IMU, every subsystem motor group
+ * and the subsystem sensors.  Prints every clash to the terminal and the controller and returns how
+ * many there are.  Every group without a clash is enabled, and every group with one stays disabled.
+ */
+int subsystem_ports_validate();
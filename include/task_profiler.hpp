@@ -0,0 +1,109 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+
+/**
+ * CPU time and stack use of one of our tasks.
+ *
+ * PROS doesn't expose FreeRTOS's run time stats or stack high water marks, so tasks measure
+ * themselves.  Each loop times its work between begin() and end(), and utilization is that time
+ * over the last SLOTS * SLOT_TIME ms.  At start() the unused part of the stack is filled with a
+ * pattern, and whatever's still untouched later is the stack that has never been needed.  Painting
+ * leaves STACK_MARGIN bytes above the task's frame for what it has already used, and is skipped
+ * with a message if the task is already deeper than that.
+ *
+ * The time between begin() and end() is wall time, so it includes any time a higher priority task
+ * took the core in the middle of the loop.  A task's cpu is an upper bound, and the total over
+ * every task can count the same time twice.  cpu_load_get() is measured separately and doesn't.
+ */
+class TaskProfile {
+ public:
+  static const int SLOTS = 8;
+  static const int SLOT_TIME = 250;  // ms
+
+  /**
+   * \param name
+   *        name shown on the debug page
+   * \param stack_depth
+   *        stack size the task was made with, in words
+   */
+  TaskProfile(const char* name, int stack_depth = TASK_STACK_DEPTH_DEFAULT);
+
+  /**
+   * Fills the unused stack with the pattern.  Call this at the top of the task, before the loop.
+   */
+  void start();
+
+  /**
+   * Call this at the start of every loop.
+   */
+  void begin();
+
+  /**
+   * Call this at the end of every loop, before delaying.
+   */
+  void end();
+
+  /**
+   * Returns the percent of one core this task used over the window.
+   */
+  double cpu_get() const;
+
+  /**
+   * Returns the bytes of stack that have never been used, -1 before start().
+   */
+  int stack_free_get() const;
+
+  const char* name;
+
+ private:
+  int stack_depth;
+  volatile uint32_t* stack_bottom = nullptr;
+  int stack_words = 0;
+
+  uint32_t loop_start = 0;
+  uint32_t slot_start = 0;
+  int slot = 0;
+  uint32_t busy[SLOTS] = {};
+  uint32_t elapsed[SLOTS] = {};
+};
+
+/**
+ * Returns every task being profiled.
+ */
+const std::vector<TaskProfile*>& task_profiles_get();
+
+/**
+ * Returns the percent of one core used by every task being profiled, added up.  This can be more
+ * than the real load since preemption is counted by both tasks, see TaskProfile.
+ */
+double task_profiles_cpu_get();
+
+/**
+ * Starts measuring the total CPU load, for the task page and telemetry.
+ *
+ * This starts a task at TASK_PRIORITY_MIN that spins reading the clock and counts the time it gets
+ * to run, so it covers everything, PROS and EZ-Template included.  It isn't free.  Every other
+ * priority 1 task round-robins with it and gets about half the core it would have, and FreeRTOS's
+ * own idle task only runs for 1 ms every SLOTS * SLOT_TIME ms, so deleted tasks are freed late.
+ * Only start it while looking at the load.
+ */
+void cpu_load_start();
+
+/**
+ * Returns the percent of the core that wasn't idle over the last SLOTS * SLOT_TIME ms, -1 until
+ * cpu_load_start() is called.
+ */
+double cpu_load_get();
+
+/**
+ * Returns cpu_load_get() minus task_profiles_cpu_get(), the load from tasks that aren't profiled.
+ * Negative means the profiled tasks counted preemption.  0 until cpu_load_start() is called.
+ */
+double cpu_other_get();
+
+/**
+ * Returns the least stack any profiled task has had free, bytes.
+ */
+int task_profiles_stack_free_get();
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "telemetry_format.hpp"
+
+// ms between telemetry packets
+inline int telemetry_period = 20;
+
+/**
+ * Starts streaming binary telemetry over USB, decode it with tools/telemetry_decode.cpp.
+ * This turns off PID printing and PROS's stream multiplexing so the packets go out as is.
+ */
+void telemetry_start();
+
+/**
+ * Stops streaming and turns stream multiplexing back on.
+ */
+void telemetry_stop();
+
+/**
+ * Returns true while telemetry is streaming.
+ */
+bool telemetry_enabled();
+
+/**
+ * Sends a packet every telemetry_period while streaming.  This runs in its own task.
+ */
+void telemetry_task();
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Telemetry goes out as COBS frames that start and end in 0x00, so a reader can find the next
+// packet after dropped bytes or printf text mixed into the stream.  The leading 0x00 ends any text
+// printed since the last frame, so that text is thrown away on its own instead of taking the
+// packet after it down with it.  Each frame holds a telemetry_packet followed
+// by a CRC-16/CCITT of it, little endian.  This is shared with tools/telemetry_decode.cpp, so it
+// can't use anything from PROS.
+
+inline const uint8_t TELEMETRY_VERSION = 3;
+
+struct __attribute__((packed)) telemetry_packet {
+  uint8_t version;
+  uint16_t sequence;
+  uint32_t time;  // ms since the program started
+
+  // Odometry
+  float x;      // in
+  float y;      // in
+  float theta;  // deg
+
+  // Drive
+  float left_velocity;   // rpm
+  float right_velocity;  // rpm
+  float drive_target;    // leftPID
+  float drive_error;
+  float drive_output;
+  float turn_target;  // turnPID
+  float turn_error;
+  float turn_output;
+
+  // Subsystems
+  uint8_t subsystem_state;
+  uint8_t subsystem_speed;
+  uint8_t balls_held;
+  uint16_t loop_time;  // us the last subsystem tick took
+
+  // Tasks
+  uint8_t task_cpu;         // % of a core used by our profiled tasks, added up so it can pass 100
+  uint8_t cpu_load;         // % of the core that wasn't idle, 255 without cpu_load_start()
+  int8_t cpu_other;         // cpu_load - task_cpu, negative when profiled tasks counted preemption
+  uint16_t stack_free_min;  // bytes, the least stack any profiled task has left
+};
+
+// Packet + CRC, plus one COBS overhead byte per 254 and the 0x00 delimiters either side
+inline const size_t TELEMETRY_FRAME_MAX = sizeof(telemetry_packet) + 2 + (sizeof(telemetry_packet) + 2) / 254 + 3;
+
+/**
+ * Returns the CRC-16/CCITT (0x1021, starting at 0xFFFF) of some bytes.
+ */
+uint16_t telemetry_crc(const uint8_t* data, size_t length);
+
+/**
+ * COBS encodes bytes so the output has no 0x00 in it.  Returns the encoded length, which is at most length + length / 254 + 1.
+ */
+size_t cobs_encode(const uint8_t* input, size_t length, uint8_t* output);
+
+/**
+ * Decodes COBS bytes, without the 0x00 delimiter.  Returns the decoded length, or 0 when the input isn't valid COBS.
+ */
+size_t cobs_decode(const uint8_t* input, size_t length, uint8_t* output);
+
+/**
+ * Builds a complete frame, both 0x00 delimiters included.  Returns its length, at most TELEMETRY_FRAME_MAX.
+ */
+size_t telemetry_frame(const telemetry_packet& packet, uint8_t* frame);
+
+/**
+ * Reads a packet back out of a frame, without the 0x00 delimiters.  Returns false when the frame
+ * is the wrong size, fails its CRC or is from another version.
+ */
+bool telemetry_unframe(const uint8_t* frame, size_t length, telemetry_packet& packet);
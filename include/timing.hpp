@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+// Scoped timers for hot paths.  Put TIME_SCOPE("name") at the top of a block and every time the
+// block runs, how long it took goes into a histogram that timing_report() prints.  Build with
+// -DTIMING_ENABLED=1 (add it to EXTRA_CXXFLAGS in the Makefile) to turn them on; otherwise
+// TIME_SCOPE is nothing at all.  This doesn't use anything from PROS so it can run on a computer,
+// where the clock is std::chrono::steady_clock instead of pros::micros().
+
+#ifndef TIMING_ENABLED
+#define TIMING_ENABLED 0
+#endif
+
+/**
+ * Returns microseconds since the program started.
+ */
+uint32_t timing_micros();
+
+/**
+ * Counts how long something took, in buckets that double in width.  Bucket 0 is 0 us, bucket 1
+ * is 1 us, bucket 2 is 2-3 us, bucket 3 is 4-7 us, and the last bucket holds everything longer.
+ */
+class TimingHistogram {
+ public:
+  static const int BUCKETS = 16;
+
+  /**
+   * \param name
+   *        name shown in the report, this has to outlive the histogram
+   */
+  TimingHistogram(const char* name);
+
+  /**
+   * Adds one run that took some microseconds.
+   */
+  void add(uint32_t micros);
+
+  /**
+   * Throws away every run.
+   */
+  void reset();
+
+  /**
+   * Returns the smallest bucket edge, in us, that the given fraction of runs took less than, or
+   * the longest run if that's shorter.
+   *
+   * \param fraction
+   *        0 to 1
+   */
+  uint32_t percentile_get(double fraction) const;
+
+  uint32_t count_get() const { return count; }
+  uint64_t total_get() const { return total; }
+  uint32_t max_get() const { return max; }
+  uint32_t bucket_get(int bucket) const { return buckets[bucket]; }
+
+  const char* name;
+
+ private:
+  uint32_t buckets[BUCKETS] = {};
+  uint32_t count = 0;
+  uint64_t total = 0;
+  uint32_t max = 0;
+};
+
+/**
+ * Adds how long it was alive to a histogram.
+ */
+class TimingScope {
+ public:
+  TimingScope(TimingHistogram& histogram) : histogram(histogram), start(timing_micros()) {}
+  ~TimingScope() { histogram.add(timing_micros() - start); }
+
+ private:
+  TimingHistogram& histogram;
+  uint32_t start;
+};
+
+#define TIMING_CONCAT_INNER(a, b) a##b
+#define TIMING_CONCAT(a, b) TIMING_CONCAT_INNER(a, b)
+
+#if TIMING_ENABLED
+#define TIME_SCOPE(name)                                                     \
+  static TimingHistogram TIMING_CONCAT(timing_histogram_, __LINE__)(name); \
+  TimingScope TIMING_CONCAT(timing_scope_, __LINE__)(TIMING_CONCAT(timing_histogram_, __LINE__))
+#else
+#define TIME_SCOPE(name) static_assert(true, "")
+#endif
+
+/**
+ * Prints count, mean, p50, p99 and max of every timed scope that has run, then the bucket counts.
+ * Safe to call while other tasks are timing.  The first 64 scopes to run are kept.
+ *
+ * \param out
+ *        where to print, stdout goes to the terminal
+ */
+void timing_report(FILE* out = stdout);
+
+/**
+ * Throws away every run of every timed scope.
+ */
+void timing_reset();
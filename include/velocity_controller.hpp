@@ -0,0 +1,8 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"
+#include "api.h"
+#include "velocity_loop.hpp"
+
+// Velocity control with an ez::PID, see velocity_loop.hpp
+using VelocityController = VelocityLoop<ez::PID>;
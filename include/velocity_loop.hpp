@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm>
+
+#include "timing.hpp"
+
+/**
+ * Velocity control for a mechanism motor.
+ *
+ * Feedforward gets the motor most of the way to the target (kV per rpm plus kS to overcome
+ * friction), and a PID on the rpm error makes up whatever the load takes away.
+ *
+ * PID is anything with ez::PID's target_set(), compute(), variables_reset() and
+ * i_reset_toggle(), so this doesn't need PROS and tools/velocity_controller_test.cpp can run it
+ * against a motor model on the host.
+ */
+template <typename PID>
+class VelocityLoop {
+ public:
+  /**
+   * \param kv
+   *        power per rpm of target, roughly 127 / free speed
+   * \param ks
+   *        power needed to start moving
+   * \param pid
+   *        PID on rpm error, its i doesn't reset when error changes sign
+   */
+  VelocityLoop(double kv, double ks, PID pid) : kv(kv), ks(ks), pid(pid) {
+    // Holding a speed needs a steady integral, it shouldn't be thrown away every time error crosses 0
+    this->pid.i_reset_toggle(false);
+  }
+
+  /**
+   * Returns the power to send to the motor, -127 to 127.
+   *
+   * \param target
+   *        target velocity, rpm
+   * \param measured
+   *        measured velocity, rpm
+   */
+  double iterate(double target, double measured) {
+    if (target == 0) {
+      reset();
+      return 0;
+    }
+    double feedforward = kv * target + ks * (target > 0 ? 1 : -1);
+    pid.target_set(target);
+    double feedback;
+    {
+      TIME_SCOPE("velocity pid compute");
+      feedback = pid.compute(measured);
+    }
+    return std::clamp(feedforward + feedback, -127.0, 127.0);
+  }
+
+  /**
+   * Clears the PID, call this when the controller has been unused.
+   */
+  void reset() { pid.variables_reset(); }
+
+  double kv;
+  double ks;
+  PID pid;
+};
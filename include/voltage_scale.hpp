@@ -0,0 +1,35 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+// V5 motors treat a command as a fraction of whatever the battery is, so the same command gives
+// less voltage as the battery sags.  Multiplying commands by nominal / battery gives the voltage
+// they would have at nominal instead.  Nothing in here talks to hardware, so
+// tools/voltage_compensation_test.cpp can check it on the host.
+
+/**
+ * Returns what to multiply a command by so it gives the voltage it would at nominal.
+ *
+ * \param nominal
+ *        mV
+ * \param battery
+ *        mV, 0 or less if it couldn't be read, which leaves commands alone
+ */
+inline double voltage_scale(double nominal, double battery) { return battery > 0 ? nominal / battery : 1.0; }
+
+/**
+ * Returns PID constants with the gains multiplied by a scale, which multiplies the PID's output by
+ * it.  start_i is an error and stays the same.  Constants is any aggregate of kp, ki, kd and start_i.
+ */
+template <typename Constants>
+Constants voltage_scale_constants(const Constants& constants, double scale) {
+  return {constants.kp * scale, constants.ki * scale, constants.kd * scale, constants.start_i};
+}
+
+/**
+ * Returns a 0 to 127 max speed multiplied by a scale, rounded and clipped to 127.
+ */
+inline int voltage_scale_speed(int speed, double scale) {
+  return std::clamp((int)std::lround(speed * scale), 0, 127);
+}
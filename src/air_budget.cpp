@@ -0,0 +1,28 @@
+#include "air_budget.hpp"
+
+static const double PI = 3.14159265358979;
+
+static double circle_area(double diameter) { return PI * diameter * diameter / 4.0; }
+
+double Cylinder::extend_volume() const { return circle_area(bore) * stroke + tubing; }
+
+double Cylinder::retract_volume() const {
+  if (!double_acting) return 0.0;
+  return (circle_area(bore) - circle_area(rod)) * stroke + tubing;
+}
+
+AirTank::AirTank() { refill(); }
+AirTank::AirTank(Constants constants) : constants(constants) { refill(); }
+
+void AirTank::use(double volume) { pressure = pressure_after(pressure, volume); }
+
+double AirTank::pressure_get() const { return pressure; }
+
+double AirTank::pressure_after(double pressure, double volume) const {
+  if (volume <= 0.0) return pressure;
+  return pressure * constants.volume / (constants.volume + volume);
+}
+
+bool AirTank::usable(double pressure) const { return pressure >= constants.min_pressure; }
+
+void AirTank::refill() { pressure = constants.start_pressure; }
@@ -8,43 +8,111 @@
 // These are out of 127
 const int DRIVE_SPEED = 110;
 const int SLOW_INTAKE = 40;
+const int LOADER_SPEED = 50;
 const int TURN_SPEED = 90;
 const int SWING_SPEED = 110;
 
+// Path actions
+static void intake_on() { set_current_state(INTAKE, 127); }
+
+// Turn constants scheduled by turn size (0 to 180 degrees) and battery voltage (11.5 to 12.8 V).
+// Small corrections need more kP to break static friction, big turns need less to avoid overshoot,
+// and a sagging battery needs a little more of everything
+const GainSchedule turn_schedule(0, 180, 11500, 12800, {{
+    //  11.5 V                    12.15 V                   12.8 V
+    {{{4.9, 0.09, 23.0, 15.0}, {4.7, 0.085, 22.0, 15.0}, {4.5, 0.08, 21.0, 15.0}}},  // 0 deg
+    {{{3.8, 0.065, 21.0, 15.0}, {3.6, 0.06, 20.5, 15.0}, {3.4, 0.055, 20.0, 15.0}}},  // 60 deg
+    {{{3.3, 0.055, 21.0, 15.0}, {3.15, 0.05, 20.5, 15.0}, {3.0, 0.05, 20.0, 15.0}}},  // 120 deg
+    {{{3.0, 0.045, 23.0, 15.0}, {2.85, 0.04, 22.5, 15.0}, {2.7, 0.04, 22.0, 15.0}}},  // 180 deg
+}});
+
 ///
 // Constants
 ///
+
+// Defaults for everything default_constants() sets, /usd/config.txt can change any of these
+robot_tuning tuning = {
+    // P, I, D, and Start I
+    .drive = {20.0, 0.0, 100.0, 0.0},       // Fwd/rev constants, used for odom and non odom motions
+    .heading = {11.0, 0.0, 20.0, 0.0},      // Holds the robot straight while going forward without odom
+    .turn = {3.0, 0.05, 20.0, 15.0},        // Turn in place constants
+    .swing = {6.0, 0.0, 65.0, 0.0},         // Swing constants
+    .odom_angular = {6.5, 0.0, 52.5, 0.0},  // Angular control for odom motions
+    .boomerang = {5.8, 0.0, 32.5, 0.0},     // Angular control for boomerang motions
+    .turn_scheduled = 1,                    // Turns use turn_schedule instead of .turn
+
+    // Exit conditions, ms and in or deg
+    .turn_exit = {90, 3, 250, 7, 500, 500},
+    .swing_exit = {90, 3, 250, 7, 500, 500},
+    .drive_exit = {90, 1, 250, 3, 500, 500},
+    .odom_turn_exit = {90, 3, 250, 7, 500, 750},
+    .odom_drive_exit = {90, 1, 250, 3, 500, 750},
+    .turn_chain = 3,   // deg
+    .swing_chain = 5,  // deg
+    .drive_chain = 3,  // in
+
+    // Slew constants
+    .turn_slew = {3, 70},   // deg
+    .drive_slew = {3, 70},  // in
+    .swing_slew = {3, 80},  // in
+
+    // The amount that turns are prioritized over driving in odom motions
+    // - if you have tracking wheels, you can run this higher.  1.0 is the max
+    .odom_turn_bias = 0.9,
+
+    .odom_look_ahead = 7,      // This is how far ahead in the path the robot looks at, in
+    .boomerang_distance = 16,  // This sets the maximum distance away from target that the carrot point can be, in
+    .boomerang_dlead = 0.625,  // This handles how aggressive the end of boomerang motions are
+};
+
+static void exit_condition_set(void (ez::Drive::*set)(int, double, int, double, int, int, bool), const exit_constants& exit) {
+  (chassis.*set)(exit.small_time, exit.small_error, exit.big_time, exit.big_error, exit.velocity_time, exit.mA_time, true);
+}
+
 void default_constants() {
-  // P, I, D, and Start I
-  chassis.pid_drive_constants_set(20.0, 0.0, 100.0);         // Fwd/rev constants, used for odom and non odom motions
-  chassis.pid_heading_constants_set(11.0, 0.0, 20.0);        // Holds the robot straight while going forward without odom
-  chassis.pid_turn_constants_set(3.0, 0.05, 20.0, 15.0);     // Turn in place constants
-  chassis.pid_swing_constants_set(6.0, 0.0, 65.0);           // Swing constants
-  chassis.pid_odom_angular_constants_set(6.5, 0.0, 52.5);    // Angular control for odom motions
-  chassis.pid_odom_boomerang_constants_set(5.8, 0.0, 32.5);  // Angular control for boomerang motions
+  const robot_tuning& t = tuning;
+  chassis.pid_drive_constants_set(t.drive.kp, t.drive.ki, t.drive.kd, t.drive.start_i);
+  chassis.pid_heading_constants_set(t.heading.kp, t.heading.ki, t.heading.kd, t.heading.start_i);
+  chassis.pid_turn_constants_set(t.turn.kp, t.turn.ki, t.turn.kd, t.turn.start_i);
+  chassis.pid_swing_constants_set(t.swing.kp, t.swing.ki, t.swing.kd, t.swing.start_i);
+  chassis.pid_odom_angular_constants_set(t.odom_angular.kp, t.odom_angular.ki, t.odom_angular.kd, t.odom_angular.start_i);
+  chassis.pid_odom_boomerang_constants_set(t.boomerang.kp, t.boomerang.ki, t.boomerang.kd, t.boomerang.start_i);
+
+  // Constants follow the battery while the PID tuner is off.  Turn constants follow turn_schedule
+  // instead, unless the config says not to
+  gain_compensate_add(&chassis.fwd_rev_drivePID, &tuning.drive);
+  gain_compensate_add(&chassis.forward_drivePID, &tuning.drive);
+  gain_compensate_add(&chassis.backward_drivePID, &tuning.drive);
+  gain_compensate_add(&chassis.headingPID, &tuning.heading);
+  gain_compensate_add(&chassis.fwd_rev_swingPID, &tuning.swing);
+  gain_compensate_add(&chassis.forward_swingPID, &tuning.swing);
+  gain_compensate_add(&chassis.backward_swingPID, &tuning.swing);
+  gain_compensate_add(&chassis.odom_angularPID, &tuning.odom_angular);
+  gain_compensate_add(&chassis.boomerangPID, &tuning.boomerang);
+  if (t.turn_scheduled)
+    gain_schedule_add(&chassis.turnPID, turn_schedule, [] { return chassis.drive_imu_get(); });
+  else
+    gain_compensate_add(&chassis.turnPID, &tuning.turn);
 
   // Exit conditions
-  chassis.pid_turn_exit_condition_set(90_ms, 3_deg, 250_ms, 7_deg, 500_ms, 500_ms);
-  chassis.pid_swing_exit_condition_set(90_ms, 3_deg, 250_ms, 7_deg, 500_ms, 500_ms);
-  chassis.pid_drive_exit_condition_set(90_ms, 1_in, 250_ms, 3_in, 500_ms, 500_ms);
-  chassis.pid_odom_turn_exit_condition_set(90_ms, 3_deg, 250_ms, 7_deg, 500_ms, 750_ms);
-  chassis.pid_odom_drive_exit_condition_set(90_ms, 1_in, 250_ms, 3_in, 500_ms, 750_ms);
-  chassis.pid_turn_chain_constant_set(3_deg);
-  chassis.pid_swing_chain_constant_set(5_deg);
-  chassis.pid_drive_chain_constant_set(3_in);
+  exit_condition_set(&ez::Drive::pid_turn_exit_condition_set, t.turn_exit);
+  exit_condition_set(&ez::Drive::pid_swing_exit_condition_set, t.swing_exit);
+  exit_condition_set(&ez::Drive::pid_drive_exit_condition_set, t.drive_exit);
+  exit_condition_set(&ez::Drive::pid_odom_turn_exit_condition_set, t.odom_turn_exit);
+  exit_condition_set(&ez::Drive::pid_odom_drive_exit_condition_set, t.odom_drive_exit);
+  chassis.pid_turn_chain_constant_set(t.turn_chain);
+  chassis.pid_swing_chain_constant_set(t.swing_chain);
+  chassis.pid_drive_chain_constant_set(t.drive_chain);
 
   // Slew constants
-  chassis.slew_turn_constants_set(3_deg, 70);
-  chassis.slew_drive_constants_set(3_in, 70);
-  chassis.slew_swing_constants_set(3_in, 80);
-
-  // The amount that turns are prioritized over driving in odom motions
-  // - if you have tracking wheels, you can run this higher.  1.0 is the max
-  chassis.odom_turn_bias_set(0.9);
+  chassis.slew_turn_constants_set(t.turn_slew.distance * okapi::degree, t.turn_slew.min_speed);
+  chassis.slew_drive_constants_set(t.drive_slew.distance * okapi::inch, t.drive_slew.min_speed);
+  chassis.slew_swing_constants_set(t.swing_slew.distance * okapi::inch, t.swing_slew.min_speed);
 
-  chassis.odom_look_ahead_set(7_in);           // This is how far ahead in the path the robot looks at
-  chassis.odom_boomerang_distance_set(16_in);  // This sets the maximum distance away from target that the carrot point can be
-  chassis.odom_boomerang_dlead_set(0.625);     // This handles how aggressive the end of boomerang motions are
+  chassis.odom_turn_bias_set(t.odom_turn_bias);
+  chassis.odom_look_ahead_set(t.odom_look_ahead);
+  chassis.odom_boomerang_distance_set(t.boomerang_distance);
+  chassis.odom_boomerang_dlead_set(t.boomerang_dlead);
 
   chassis.pid_angle_behavior_set(ez::shortest);  // Changes the default behavior for turning, this defaults it to the shortest path there
 }
@@ -276,14 +344,14 @@ void odom_pure_pursuit_example() {
 // Odom Pure Pursuit Wait Until
 ///
 void odom_pure_pursuit_wait_until_example() {
-  chassis.pid_odom_set({{{0_in, 24_in}, fwd, DRIVE_SPEED},
+  // The intake starts on the tick the robot passes 12, 24, without the auton waiting for it
+  pid_odom_actions_set({{{0_in, 24_in}, fwd, DRIVE_SPEED},
                         {{12_in, 24_in}, fwd, DRIVE_SPEED},
                         {{24_in, 24_in}, fwd, DRIVE_SPEED}},
+                       {at_index(1, intake_on)},
                        true);
-  chassis.pid_wait_until_index(1);  // Waits until the robot passes 12, 24
-  // Intake.move(127);  // Set your intake to start moving once it passes through the second point in the index
   chassis.pid_wait();
-  // Intake.move(0);  // Turn the intake off
+  set_current_state(STOP, 0);  // Turn the intake off
 }
 
 ///
@@ -377,7 +445,48 @@ void measure_offsets() {
 // . . .
 // Make your own autonomous functions here!
 // . . .
-void match_loader();
+
+///
+// Match Loader
+///
+// Start lined up in front of the loader.  This drops the scraper, pushes into the loader and holds
+// there while intaking until enough balls came in, the loader runs dry or it times out
+int match_loader(int balls, int timeout) {
+  int start_held = balls_held_get();
+  balls = std::min(balls, balls_capacity_get() - start_held);  // The intake stops once the robot is full
+  if (balls <= 0) return 0;
+  scraper.set(true);
+
+  chassis.pid_odom_set(6_in, LOADER_SPEED);
+  chassis.pid_wait();  // Stalling against the loader ends this, and the drive keeps holding its target after
+
+  LoadMonitor monitor;
+  monitor.start(balls, timeout, pros::millis());
+  set_current_state(INTAKE, 127);
+  while (!monitor.iterate(balls_held_get() - start_held, intake_motors.current_get(), balls_full(), pros::millis())) {
+    pros::delay(ez::util::DELAY_TIME);
+  }
+  set_current_state(STOP, 0);
+  scraper.set(false);
+
+  printf("Match loader: %i balls, %s\n", monitor.loaded_get(),
+         monitor.result_get() == LoadMonitor::FILLED ? "filled" : monitor.result_get() == LoadMonitor::DRY ? "dry" : "timed out");
+  return monitor.loaded_get();
+}
+
+// Multi point paths of skills_bottom_bot, generated before the match
+static PathPlan skills_bottom_intake_1(skills_bottom_bot, {24.328_in, -59.5_in},
+                                       {{{12.443_in, -53.003_in}, fwd, DRIVE_SPEED},
+                                        {{7.35_in, -50.363_in}, fwd, SLOW_INTAKE}});
+static PathPlan skills_bottom_intake_2(skills_bottom_bot, {47.155_in, -47_in},
+                                       {{{47.155_in, -58.851_in}, fwd, DRIVE_SPEED},
+                                        {{47.155_in, -63.756_in}, fwd, SLOW_INTAKE}});
+static PathPlan skills_bottom_intake_3(skills_bottom_bot, {55.267_in, -31.308_in},
+                                       {{{55.267_in, -12.066_in}, fwd, DRIVE_SPEED},
+                                        {{55.456_in, 12.081_in}, fwd, SLOW_INTAKE}});
+static PathPlan skills_bottom_intake_4(skills_bottom_bot, {47.155_in, 47.547_in},
+                                       {{{47.155_in, 57.54_in}, fwd, DRIVE_SPEED},
+                                        {{47.155_in, 64.714_in}, fwd, SLOW_INTAKE}});
 
 // Bottom Bot
 void skills_bottom_bot() {
@@ -399,16 +508,12 @@ void skills_bottom_bot() {
   // Turn to point (7.35, -50.362)
   chassis.pid_turn_set({7.35_in, -50.362_in}, fwd, 90);
 
-  // Move to points (24.328, -59.5), (12.443, -53.003), (7.35, -50.363)
+  // Move to points (12.443, -53.003), (7.35, -50.363)
   // After passing (12.443, -53.003) --> the intake spins
   // Intakes two blue blocks
-  chassis.pid_odom_set({{{24.328_in, -59.5_in}, fwd, DRIVE_SPEED},
-                        {{12.443_in, -53.003_in}, fwd, DRIVE_SPEED},
-                        {{7.35_in, -50.363_in}, fwd, SLOW_INTAKE}},
-                       true);
-  chassis.pid_wait_until_index(1);
-  // --> Enable intake here
+  pid_odom_actions_set(skills_bottom_intake_1, {at_index(0, intake_on)}, true);
   chassis.pid_wait();
+  set_current_state(STOP, 0);  // Intake off
 
   // Move to point (32.818, -64.511)
   chassis.pid_odom_set({{32.818_in, -64.511_in}, rev, DRIVE_SPEED});
@@ -431,6 +536,7 @@ void skills_bottom_bot() {
   chassis.pid_wait();
 
   // Match Loader / Intake
+  match_loader();
 
   // Move to point (44.891, -47.155)
   chassis.pid_odom_set({{44.891_in, -47.155_in}, rev, DRIVE_SPEED});
@@ -441,11 +547,12 @@ void skills_bottom_bot() {
   chassis.pid_wait();
 
   // Move to point (26.592, -47)
+  outtake_approach(LONG_GOAL, 26.592, -47);
   chassis.pid_odom_set({{26.592_in, -47_in}, fwd, DRIVE_SPEED});
   chassis.pid_wait();
 
   // Score Bottom Long Goal
-  // Outtake
+  score_balls(SCORE, balls_held_get(), 2000);
 
   // Move to point (44.891, -47.155)
   chassis.pid_odom_set({{47.155_in, -47_in}, rev, DRIVE_SPEED});
@@ -455,17 +562,12 @@ void skills_bottom_bot() {
   chassis.pid_turn_set({47.155_in, -63.756_in}, fwd, 90);
   chassis.pid_wait();
 
-  // Move to points (7.155, -47), (47.155, -58.851), (47.155, -63.756)
+  // Move to points (47.155, -58.851), (47.155, -63.756)
   // After passing (47.155, -58.851) --> the intake spins
   // Intakes two red blocks
-  chassis.pid_odom_set({{{47.155_in, -47_in}, fwd, DRIVE_SPEED},
-                        {{47.155_in, -58.851_in}, fwd, DRIVE_SPEED},
-                        {{47.155_in, -63.756_in}, fwd, SLOW_INTAKE}},
-                       true);
-  chassis.pid_wait_until_index(1);
-  // Intake on
+  pid_odom_actions_set(skills_bottom_intake_2, {at_index(0, intake_on)}, true);
   chassis.pid_wait();
-  // Intake off
+  set_current_state(STOP, 0);  // Intake off
 
   // Move to point (44.891, -47.344)
   chassis.pid_odom_set({{47.155_in, -47.344_in}, rev, DRIVE_SPEED});
@@ -480,13 +582,9 @@ void skills_bottom_bot() {
   chassis.pid_wait();
 
   // Move to point (55.267, -12.066)
-  chassis.pid_odom_set({{{55.267_in, -12.066_in}, fwd, DRIVE_SPEED},
-                        {{55.456_in, 12.081_in}, fwd, SLOW_INTAKE}},
-                       true);
-  chassis.pid_wait_until(0);
-  // Intake on --> 4 red blocks
+  pid_odom_actions_set(skills_bottom_intake_3, {at_distance(0, intake_on)}, true);
   chassis.pid_wait();
-  // Intake off
+  set_current_state(STOP, 0);  // Intake off
 
   // Move to point (35.27, 34.342)
   chassis.pid_odom_set({{35.27_in, 34.342_in}, fwd, DRIVE_SPEED});
@@ -497,10 +595,12 @@ void skills_bottom_bot() {
   chassis.pid_wait();
 
   // Move to point (9.425, 9.251)
+  outtake_approach(MIDDLE_GOAL, 9.425, 9.251);
   chassis.pid_odom_set({{9.425_in, 9.251_in}, fwd, DRIVE_SPEED});
   chassis.pid_wait();
 
-  // Score Middle Goal / Outtake on
+  // Score Middle Goal
+  score_balls(SCORE_SLOWLY, balls_held_get(), 2500);
 
   // Move to point (47.155, 47.547)
   chassis.pid_odom_set({{47.155_in, 47.547_in}, rev, DRIVE_SPEED});
@@ -511,14 +611,9 @@ void skills_bottom_bot() {
   chassis.pid_wait();
 
   // Move to point (47.155, 64.714) with intake on
-  chassis.pid_odom_set({{{47.155_in, 47.547_in}, fwd, DRIVE_SPEED},
-                        {{47.155_in, 57.54_in}, fwd, DRIVE_SPEED},
-                        {{47.155_in, 64.714_in}, fwd, SLOW_INTAKE}},
-                       true);
-  chassis.pid_wait_until(0);
-  // Intake on --> 2 red blocks
+  pid_odom_actions_set(skills_bottom_intake_4, {at_distance(0, intake_on)}, true);
   chassis.pid_wait();
-  // Intake off
+  set_current_state(STOP, 0);  // Intake off
 
   // Move to point (47.155, 47.547)
   chassis.pid_odom_set({{47.155_in, 47.547_in}, rev, DRIVE_SPEED});
@@ -532,7 +627,8 @@ void skills_bottom_bot() {
   chassis.pid_odom_set({{60.172_in, 46.793_in}, fwd, DRIVE_SPEED});
   chassis.pid_wait();
 
-  // Intake
+  // Match Loader / Intake
+  match_loader();
 
   // Move to point (47.155, 47.547)
   chassis.pid_odom_set({{47.155_in, 47.547_in}, rev, DRIVE_SPEED});
@@ -543,11 +639,12 @@ void skills_bottom_bot() {
   chassis.pid_wait();
 
   // Move to point (47.155, 47.547)
+  outtake_approach(LONG_GOAL, 27.158, 47.17);
   chassis.pid_odom_set({{27.158_in, 47.17_in}, fwd, DRIVE_SPEED});
   chassis.pid_wait();
 
   // Score Top Long Goal
-  // Outtake
+  score_balls(SCORE, balls_held_get(), 2000);
 
   // Move to point (47.155, 47.547)
   chassis.pid_odom_set({{47.155_in, 47.547_in}, rev, DRIVE_SPEED});
@@ -568,6 +665,14 @@ void skills_bottom_bot() {
   // Parked
 }
 
+// Multi point paths of skills_top_bot, generated before the match
+static PathPlan skills_top_intake_1(skills_top_bot, {-47.17_in, 46.981_in},
+                                    {{{-47.17_in, 59.352_in}, fwd, DRIVE_SPEED},
+                                     {{-47.17_in, 63.205_in}, fwd, SLOW_INTAKE}});
+static PathPlan skills_top_intake_2(skills_top_bot, {-56.225_in, 30.946_in},
+                                    {{{-56.037_in, 11.327_in}, fwd, DRIVE_SPEED},
+                                     {{-56.414_in, -13.198_in}, fwd, SLOW_INTAKE}});
+
 // Top Bot
 void skills_top_bot() {
   // Set starting position bot at (-54,11.892), orientation: 20 degrees
@@ -585,7 +690,8 @@ void skills_top_bot() {
   chassis.pid_odom_set({{-62.639_in, 46.79_in}, fwd, DRIVE_SPEED});
   chassis.pid_wait();
 
-  // Intake On
+  // Match Loader / Intake
+  match_loader();
 
   // Move to point (-47.17, 46.981)
   chassis.pid_odom_set({{-47.17_in, 46.981_in}, rev, DRIVE_SPEED});
@@ -596,11 +702,12 @@ void skills_top_bot() {
   chassis.pid_wait();
 
   // Move to point (-47.17, 46.981)
+  outtake_approach(LONG_GOAL, -27.55, 46.79);
   chassis.pid_odom_set({{-27.55_in, 46.79_in}, fwd, DRIVE_SPEED});
   chassis.pid_wait();
 
   // Score Top Long Goal
-  // Outtake
+  score_balls(SCORE, balls_held_get(), 2000);
 
   // Move to point (-47.17, 46.981)
   chassis.pid_odom_set({{-47.17_in, 46.981_in}, rev, DRIVE_SPEED});
@@ -612,14 +719,9 @@ void skills_top_bot() {
 
 
   // Move to point (47.155, 64.714) with intake on
-  chassis.pid_odom_set({{{-47.17_in, 46.981_in}, fwd, DRIVE_SPEED},
-                        {{-47.17_in, 59.352_in}, fwd, DRIVE_SPEED},
-                        {{-47.17_in, 63.205_in}, fwd, SLOW_INTAKE}},
-                       true);
-  chassis.pid_wait_until(0);
-  // Intake on --> 2 blue blocks
+  pid_odom_actions_set(skills_top_intake_1, {at_distance(0, intake_on)}, true);
   chassis.pid_wait();
-  // Intake off
+  set_current_state(STOP, 0);  // Intake off
 
   // Move to point (-56.225, 30.946)
   chassis.pid_odom_set({{-56.225_in, 30.946_in}, rev, DRIVE_SPEED});
@@ -630,14 +732,9 @@ void skills_top_bot() {
   chassis.pid_wait();
 
   // Move to point (-56.414, -13.198) with intake on
-  chassis.pid_odom_set({{{-56.225_in, 30.946_in}, fwd, DRIVE_SPEED},
-                        {{-56.037_in, 11.327_in}, fwd, DRIVE_SPEED},
-                        {{-56.414_in, -13.198_in}, fwd, SLOW_INTAKE}},
-                       true);
-  chassis.pid_wait_until(0);
-  // Intake on --> 4 blue blocks
+  pid_odom_actions_set(skills_top_intake_2, {at_distance(0, intake_on)}, true);
   chassis.pid_wait();
-  // Intake off
+  set_current_state(STOP, 0);  // Intake off
 
   // Turn to point (-26.796, 28.682)
   chassis.pid_turn_set({-26.796_in, 28.682_in}, fwd, 90);
@@ -652,11 +749,12 @@ void skills_top_bot() {
   chassis.pid_wait();
 
   // Move to point (-10.383, 10.383)
+  outtake_approach(MIDDLE_GOAL, -10.383, 10.383);
   chassis.pid_odom_set({{-10.383_in, 10.383_in}, fwd, DRIVE_SPEED});
   chassis.pid_wait();
 
   // Score Middle Goal
-  // Outtake
+  score_balls(SCORE_SLOWLY, balls_held_get(), 2500);
 
   // Move to point (-33.399, 34.342)
   chassis.pid_odom_set({{-33.399_in, 34.342_in}, rev, DRIVE_SPEED});
@@ -685,6 +783,7 @@ void skills_top_bot() {
   chassis.pid_wait();
 
   // Intake Match Loader
+  match_loader();
 
   // Move to point (-46.604, -47.532)
   chassis.pid_odom_set({{-46.604_in, -47.532_in}, rev, DRIVE_SPEED});
@@ -696,11 +795,12 @@ void skills_top_bot() {
 
 
   // Move to point (-27.55, -47.155)
+  outtake_approach(LONG_GOAL, -27.55, -47.155);
   chassis.pid_odom_set({{-27.55_in, -47.155_in}, fwd, DRIVE_SPEED});
   chassis.pid_wait();
 
   // Score Bottom Long Goal
-  // Outtake
+  score_balls(SCORE, balls_held_get(), 2000);
 
   // Move to point (-63.205, -27.347)
   chassis.pid_odom_set({{-63.205_in, -27.347_in}, rev, DRIVE_SPEED});
@@ -717,8 +817,17 @@ void skills_top_bot() {
   // Parked
 }
 
+// Multi point paths of head_two_head_bottom, generated before the match
+static PathPlan head_two_head_bottom_intake(head_two_head_bottom, {-32.078_in, -16.216_in},
+                                            {{{-8.422_in, -19.961_in}, fwd, DRIVE_SPEED},
+                                             {{-1.78_in, -26.201_in}, fwd, SLOW_INTAKE},
+                                             {{-0.008_in, -37.722_in}, fwd, SLOW_INTAKE}});
+
 // Bottom Bot
 void head_two_head_bottom(const std::string& color) {
+  // Keep our own color and throw out the other alliance's
+  color_sort_alliance_set(color == "blue" ? BALL_BLUE : BALL_RED);
+
   // Mirror Auto
   if (color == "blue") {
     chassis.odom_x_flip();
@@ -732,14 +841,9 @@ void head_two_head_bottom(const std::string& color) {
   chassis.pid_wait();
 
   // Move to point (-0.008, -37.722) with intake on
-  chassis.pid_odom_set({{{-8.422_in, -19.961_in}, fwd, DRIVE_SPEED},
-                        {{-1.78_in, -26.201_in}, fwd, SLOW_INTAKE},
-                        {{-0.008_in, -37.722_in}, fwd, SLOW_INTAKE}},
-                       true);
-  chassis.pid_wait_until(0);
-  // Intake on --> 3 red blocks
+  pid_odom_actions_set(head_two_head_bottom_intake, {at_distance(0, intake_on)}, true);
   chassis.pid_wait();
-  // Intake off
+  set_current_state(STOP, 0);  // Intake off
 
   // Move to point (0.032, -31.838)
   chassis.pid_odom_set({{0.032_in, -31.838_in}, rev, DRIVE_SPEED});
@@ -758,11 +862,12 @@ void head_two_head_bottom(const std::string& color) {
   chassis.pid_wait();
 
   // Move to point (-10.761, -11.123)
+  outtake_approach(MIDDLE_GOAL, -10.761, -11.123);
   chassis.pid_odom_set({{-10.761_in, -11.123_in}, fwd, DRIVE_SPEED});
   chassis.pid_wait();
 
   // Score Middle Goal
-  // Outtake
+  score_balls(SCORE_SLOWLY, balls_held_get(), 2500);
 
   // Move to point (-47.736, -46.966)
   chassis.pid_odom_set({{-47.736_in, -46.966_in}, rev, DRIVE_SPEED});
@@ -777,6 +882,7 @@ void head_two_head_bottom(const std::string& color) {
   chassis.pid_wait();
 
   // Match Loader Intake
+  match_loader();
 
   // Move to point (-47.736, -46.966)
   chassis.pid_odom_set({{-47.736_in, -46.966_in}, rev, DRIVE_SPEED});
@@ -787,11 +893,12 @@ void head_two_head_bottom(const std::string& color) {
   chassis.pid_wait();
 
   // Move to point (-27.173, -47.344)
+  outtake_approach(LONG_GOAL, -27.173, -47.344);
   chassis.pid_odom_set({{-27.173_in, -47.344_in}, fwd, DRIVE_SPEED});
   chassis.pid_wait();
 
   // Score Bottom Long Goal
-  // Outtake
+  score_balls(SCORE, balls_held_get(), 2000);
 
   // Move to point (-52.83, -36.779)
   chassis.pid_odom_set({{-52.83_in, -36.779_in}, rev, DRIVE_SPEED});
@@ -809,8 +916,16 @@ void head_two_head_bottom(const std::string& color) {
   // Finish
 }
 
+// Multi point paths of head_two_head_top, generated before the match
+static PathPlan head_two_head_top_intake(head_two_head_top, {-5.667_in, 21.136_in},
+                                         {{{-0.169_in, -29.157_in}, fwd, SLOW_INTAKE},
+                                          {{-0.196_in, 36.794_in}, fwd, SLOW_INTAKE}});
+
 // Top Bot
 void head_two_head_top(const std::string& color) {
+  // Keep our own color and throw out the other alliance's
+  color_sort_alliance_set(color == "blue" ? BALL_BLUE : BALL_RED);
+
   if (color == "blue") {
     chassis.odom_x_flip();
     chassis.odom_theta_flip();
@@ -824,14 +939,9 @@ void head_two_head_top(const std::string& color) {
   chassis.pid_wait();
 
   // Move to point (-0.196, 36.794) with intake on
-  chassis.pid_odom_set({{{-5.667_in, 21.136_in}, fwd, DRIVE_SPEED},
-                        {{-0.169_in, -29.157_in}, fwd, SLOW_INTAKE},
-                        {{-0.196_in, 36.794_in}, fwd, SLOW_INTAKE}},
-                       true);
-  chassis.pid_wait_until(0);
-  // Intake on --> 3 red blocks
+  pid_odom_actions_set(head_two_head_top_intake, {at_distance(0, intake_on)}, true);
   chassis.pid_wait();
-  // Intake off
+  set_current_state(STOP, 0);  // Intake off
 
   // Turn to point (-34.342, 36.228)
   chassis.pid_turn_set({-34.342_in, 36.228_in}, fwd, 90);
@@ -854,6 +964,7 @@ void head_two_head_top(const std::string& color) {
   chassis.pid_wait();
 
   // Match Loader Intake
+  match_loader();
 
   // Move to point (-45.472, 46.981)
   chassis.pid_odom_set({{-45.472_in, 46.981_in}, rev, DRIVE_SPEED});
@@ -864,11 +975,12 @@ void head_two_head_top(const std::string& color) {
   chassis.pid_wait();
 
   // Move to point(-25.098, 47.359)
+  outtake_approach(LONG_GOAL, -25.098, 47.359);
   chassis.pid_odom_set({{-25.098_in, 47.359_in}, fwd, DRIVE_SPEED});
   chassis.pid_wait();
 
   // Score Top Long Goal
-  // Outtake
+  score_balls(SCORE, balls_held_get(), 2000);
 
   // Finish
 }
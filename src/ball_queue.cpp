@@ -0,0 +1,56 @@
+#include "ball_queue.hpp"
+
+#include <algorithm>
+
+BallQueue::BallQueue() {}
+BallQueue::BallQueue(Constants constants) : constants(constants) {}
+
+void BallQueue::enter() {
+  if (count >= MAX_BALLS) return;
+  positions[count] = 0;
+  count++;
+}
+
+void BallQueue::advance(double bottom_travel, double top_travel, bool ejecting) {
+  double exit_position = constants.bottom_length + constants.top_length;
+  int kept = 0;
+  for (int i = 0; i < count; i++) {
+    double position = positions[i];
+    bool in_bottom = position < constants.bottom_length;
+    double travel = in_bottom ? bottom_travel : top_travel;
+    double next = position + travel;
+
+    // Balls wait at the top stage until it pulls them in
+    if (in_bottom && next > constants.bottom_length && top_travel <= 0) next = constants.bottom_length;
+
+    // Balls can't push through the one in front of them
+    if (travel > 0 && kept > 0) next = std::max(position, std::min(next, positions[kept - 1] - constants.ball_spacing));
+
+    if (next >= exit_position) {
+      if (ejecting)
+        ejected++;
+      else
+        scored++;
+      continue;
+    }
+    if (next < 0) continue;  // Pushed back out the intake
+
+    positions[kept] = next;
+    kept++;
+  }
+  count = kept;
+}
+
+int BallQueue::count_get() const { return count; }
+
+bool BallQueue::full() const { return count >= constants.capacity; }
+
+double BallQueue::position_get(int ball) const { return ball >= 0 && ball < count ? positions[ball] : 0; }
+
+int BallQueue::scored_get() const { return scored; }
+
+int BallQueue::ejected_get() const { return ejected; }
+
+void BallQueue::scored_reset() { scored = 0; }
+
+void BallQueue::clear() { count = 0; }
@@ -0,0 +1,47 @@
+#include "main.h"
+
+static BallQueue ball_queue;
+static bool ball_at_entry = false;
+static double last_bottom = 0;
+static double last_top = 0;
+
+// Belt travel of a stage in inches
+static double belt_position(const SubsystemMotors& stage) { return stage.position_get() / 360.0 * conveyor_travel_per_rev; }
+
+void ball_tracking_iterate(bool ejecting) {
+  TIME_SCOPE("ball_tracking_iterate");
+  int distance = intake_entry_sensor.get_distance();
+  if (!ball_at_entry && distance < intake_entry_enter) {
+    ball_at_entry = true;
+    ball_queue.enter();
+  } else if (ball_at_entry && distance > intake_entry_exit) {
+    ball_at_entry = false;
+  }
+
+  double bottom = belt_position(bottom_conveyor);
+  double top = belt_position(top_conveyor);
+  ball_queue.advance(bottom - last_bottom, top - last_top, ejecting);
+  last_bottom = bottom;
+  last_top = top;
+}
+
+int balls_held_get() { return ball_queue.count_get(); }
+
+bool balls_full() { return ball_queue.full(); }
+
+int balls_capacity_get() { return ball_queue.constants.capacity; }
+
+int balls_scored_get() { return ball_queue.scored_get(); }
+
+void balls_scored_reset() { ball_queue.scored_reset(); }
+
+int score_balls(state goal, int count, int timeout) {
+  balls_scored_reset();
+  set_current_state(goal, 127);
+  uint32_t start = pros::millis();
+  while ((count <= 0 || balls_scored_get() < count) && pros::millis() - start < (uint32_t)timeout) {
+    pros::delay(ez::util::DELAY_TIME);
+  }
+  set_current_state(STOP, 0);
+  return balls_scored_get();
+}
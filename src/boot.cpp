@@ -0,0 +1,52 @@
+#include "main.h"
+
+static uint32_t boot_start = 0;
+static int boot_time = -1;
+
+// Function local so it exists before any phase registers itself, no matter the initialization order
+static std::vector<BootPhase*>& phases() {
+  static std::vector<BootPhase*> registered;
+  return registered;
+}
+
+BootPhase::BootPhase(const char* name, void (*work)(), BootPhase* after) : name(name), work(work), after(after) {
+  phases().push_back(this);
+}
+
+void BootPhase::start() {
+  pros::Task task([this] { run(); }, name);
+}
+
+void BootPhase::run() {
+  if (after != nullptr) after->join();
+  uint32_t start = pros::millis();
+  work();
+  took = pros::millis() - start;
+  finished = true;
+
+  // boot_end() has already printed the report without this one
+  if (boot_time >= 0) printf("  %-10s %5i ms, after initialize\n", name, (int)took);
+}
+
+void BootPhase::join() const {
+  while (!finished) pros::delay(ez::util::DELAY_TIME);
+}
+
+bool BootPhase::done() const { return finished; }
+
+int BootPhase::time_get() const { return took; }
+
+void boot_begin() { boot_start = pros::millis(); }
+
+void boot_end() {
+  boot_time = pros::millis() - boot_start;
+  printf("\ninitialize: %i ms\n", boot_time);
+  for (auto phase : phases()) {
+    if (phase->done())
+      printf("  %-10s %5i ms\n", phase->name, phase->time_get());
+    else
+      printf("  %-10s  still running\n", phase->name);
+  }
+}
+
+int boot_time_get() { return boot_time; }
@@ -0,0 +1,21 @@
+#include "main.h"
+
+static ColorSorter sorter;
+
+void color_sort_initialize() {
+  color_sensor.set_integration_time(3);  // Fastest the sensor can go
+  color_sensor.set_led_pwm(100);
+}
+
+void color_sort_alliance_set(ball_color color) { sorter.alliance_set(color); }
+
+void color_sort_reset() { sorter.reset(); }
+
+int color_sort_ejected_get() { return sorter.ejected_get(); }
+
+bool color_sort_iterate() {
+  TIME_SCOPE("color_sort_iterate");
+  double position = top_conveyor.position_get() / 360.0 * conveyor_travel_per_rev;
+  double velocity = top_conveyor.velocity_get() / 60.0 * conveyor_travel_per_rev;
+  return sorter.iterate(color_sensor.get_hue(), color_sensor.get_proximity(), position, velocity);
+}
@@ -0,0 +1,68 @@
+#include "color_sorter.hpp"
+
+#include <cmath>
+
+ColorSorter::ColorSorter() {}
+ColorSorter::ColorSorter(Constants constants) : constants(constants) {}
+
+void ColorSorter::alliance_set(ball_color color) { alliance = color; }
+
+ball_color ColorSorter::alliance_get() const { return alliance; }
+
+ball_color ColorSorter::color_get() const { return current_color; }
+
+int ColorSorter::ejected_get() const { return ejected; }
+
+void ColorSorter::reset() {
+  pending_count = 0;
+  ejecting = false;
+}
+
+// Distance between two hues, going the short way around the wheel
+static double hue_distance(double a, double b) {
+  double distance = std::fmod(std::fabs(a - b), 360.0);
+  return distance > 180.0 ? 360.0 - distance : distance;
+}
+
+ball_color ColorSorter::classify(double hue, ball_color current) const {
+  // Keep the current color until the hue leaves its wider exit band
+  if (current == BALL_RED && hue_distance(hue, constants.red_hue) <= constants.exit_band) return BALL_RED;
+  if (current == BALL_BLUE && hue_distance(hue, constants.blue_hue) <= constants.exit_band) return BALL_BLUE;
+
+  if (hue_distance(hue, constants.red_hue) <= constants.enter_band) return BALL_RED;
+  if (hue_distance(hue, constants.blue_hue) <= constants.enter_band) return BALL_BLUE;
+  return BALL_NONE;
+}
+
+bool ColorSorter::iterate(double hue, int proximity, double position, double velocity) {
+  // Only trust the hue while a ball is right in front of the sensor
+  if (!ball_present && proximity >= constants.proximity_enter) {
+    ball_present = true;
+    ball_scheduled = false;
+  } else if (ball_present && proximity < constants.proximity_exit) {
+    ball_present = false;
+  }
+  current_color = ball_present ? classify(hue, current_color) : BALL_NONE;
+
+  // Schedule each wrong colored ball once
+  if (ball_present && !ball_scheduled && alliance != BALL_NONE && current_color != BALL_NONE && current_color != alliance) {
+    ball_scheduled = true;
+    if (pending_count < MAX_PENDING) {
+      pending[(pending_head + pending_count) % MAX_PENDING] = position + constants.eject_distance;
+      pending_count++;
+    }
+  }
+
+  // Look ahead by how far the belt will move before the eject reacts
+  double lead_position = position + velocity * constants.actuator_delay / 1000.0;
+  while (pending_count > 0 && lead_position >= pending[pending_head]) {
+    eject_end = pending[pending_head] + constants.eject_length;
+    ejecting = true;
+    ejected++;
+    pending_head = (pending_head + 1) % MAX_PENDING;
+    pending_count--;
+  }
+  if (ejecting && lead_position >= eject_end) ejecting = false;
+
+  return ejecting;
+}
@@ -0,0 +1,167 @@
+#include "main.h"
+
+static const char* CONFIG_FILE = "/usd/config.txt";
+
+static ConfigStore store(CONFIG_VERSION);
+static char config_buffer[4096];
+
+// A key that can't be bound is never loaded or saved, so say why
+template <typename T>
+static void bind(const char* key, T* value) {
+  if (store.add(key, value)) return;
+  if (store.count_get() >= ConfigStore::KEYS_MAX)
+    printf("Config can't bind %s, over %i settings\n", key, ConfigStore::KEYS_MAX);
+  else
+    printf("Config can't bind %s, it's already bound\n", key);
+}
+
+// Keys are spelled out instead of built so they can be searched for
+static void bind_pid(const char* kp, const char* ki, const char* kd, const char* start_i, ez::PID::Constants& constants) {
+  bind(kp, &constants.kp);
+  bind(ki, &constants.ki);
+  bind(kd, &constants.kd);
+  bind(start_i, &constants.start_i);
+}
+
+static void bind_exit(const char* small_time, const char* small_error, const char* big_time, const char* big_error,
+                      const char* velocity_time, const char* mA_time, exit_constants& exit) {
+  bind(small_time, &exit.small_time);
+  bind(small_error, &exit.small_error);
+  bind(big_time, &exit.big_time);
+  bind(big_error, &exit.big_error);
+  bind(velocity_time, &exit.velocity_time);
+  bind(mA_time, &exit.mA_time);
+}
+
+static void config_bind() {
+  if (store.count_get() > 0) return;
+
+  bind_pid("drive.kp", "drive.ki", "drive.kd", "drive.start_i", tuning.drive);
+  bind_pid("heading.kp", "heading.ki", "heading.kd", "heading.start_i", tuning.heading);
+  bind_pid("turn.kp", "turn.ki", "turn.kd", "turn.start_i", tuning.turn);
+  bind("turn.scheduled", &tuning.turn_scheduled);
+  bind_pid("swing.kp", "swing.ki", "swing.kd", "swing.start_i", tuning.swing);
+  bind_pid("odom_angular.kp", "odom_angular.ki", "odom_angular.kd", "odom_angular.start_i", tuning.odom_angular);
+  bind_pid("boomerang.kp", "boomerang.ki", "boomerang.kd", "boomerang.start_i", tuning.boomerang);
+
+  bind_exit("turn_exit.small_time", "turn_exit.small_error", "turn_exit.big_time", "turn_exit.big_error",
+            "turn_exit.velocity_time", "turn_exit.mA_time", tuning.turn_exit);
+  bind_exit("swing_exit.small_time", "swing_exit.small_error", "swing_exit.big_time", "swing_exit.big_error",
+            "swing_exit.velocity_time", "swing_exit.mA_time", tuning.swing_exit);
+  bind_exit("drive_exit.small_time", "drive_exit.small_error", "drive_exit.big_time", "drive_exit.big_error",
+            "drive_exit.velocity_time", "drive_exit.mA_time", tuning.drive_exit);
+  bind_exit("odom_turn_exit.small_time", "odom_turn_exit.small_error", "odom_turn_exit.big_time", "odom_turn_exit.big_error",
+            "odom_turn_exit.velocity_time", "odom_turn_exit.mA_time", tuning.odom_turn_exit);
+  bind_exit("odom_drive_exit.small_time", "odom_drive_exit.small_error", "odom_drive_exit.big_time", "odom_drive_exit.big_error",
+            "odom_drive_exit.velocity_time", "odom_drive_exit.mA_time", tuning.odom_drive_exit);
+  bind("turn_chain", &tuning.turn_chain);
+  bind("swing_chain", &tuning.swing_chain);
+  bind("drive_chain", &tuning.drive_chain);
+
+  bind("turn_slew.distance", &tuning.turn_slew.distance);
+  bind("turn_slew.min_speed", &tuning.turn_slew.min_speed);
+  bind("drive_slew.distance", &tuning.drive_slew.distance);
+  bind("drive_slew.min_speed", &tuning.drive_slew.min_speed);
+  bind("swing_slew.distance", &tuning.swing_slew.distance);
+  bind("swing_slew.min_speed", &tuning.swing_slew.min_speed);
+
+  bind("odom.turn_bias", &tuning.odom_turn_bias);
+  bind("odom.look_ahead", &tuning.odom_look_ahead);
+  bind("odom.boomerang_distance", &tuning.boomerang_distance);
+  bind("odom.boomerang_dlead", &tuning.boomerang_dlead);
+
+  // Subsystems
+  bind("conveyor.slow_bps", &conveyor_slow_bps);
+  bind("conveyor.fast_bps", &conveyor_fast_bps);
+  bind("outtake.long_goal_rpm", &outtake_long_goal_rpm);
+  bind("outtake.middle_goal_rpm", &outtake_middle_goal_rpm);
+  bind("drive.nominal_voltage", &NOMINAL_VOLTAGE);
+  bind("color_sort.alliance", &color_sort_alliance);
+}
+
+void config_load() {
+  config_bind();
+  if (!ez::util::SD_CARD_ACTIVE) return;
+
+  FILE* file = fopen(CONFIG_FILE, "r");
+  if (file == nullptr) return;  // Nothing saved yet, keep the defaults
+  size_t length = fread(config_buffer, 1, sizeof(config_buffer) - 1, file);
+  bool truncated = length == sizeof(config_buffer) - 1 && fgetc(file) != EOF;
+  fclose(file);
+  config_buffer[length] = '\0';
+
+  // Half a file could cut a number short and load it, so load none of it
+  if (truncated) {
+    printf("%s is over %i bytes, using defaults\n", CONFIG_FILE, (int)sizeof(config_buffer) - 1);
+    return;
+  }
+
+  ConfigStore::load_result result = store.parse(config_buffer);
+  if (!result.accepted && result.version == -1)
+    printf("%s doesn't start with a whole number version, using defaults\n", CONFIG_FILE);
+  else if (!result.accepted)
+    printf("%s is version %i, expected %i, using defaults\n", CONFIG_FILE, result.version, CONFIG_VERSION);
+  else
+    printf("Loaded %i settings from %s, %i unknown, %i bad\n", result.loaded, CONFIG_FILE, result.unknown, result.bad);
+  subsystem_speeds_update();
+  if (color_sort_alliance < BALL_NONE || color_sort_alliance > BALL_BLUE) color_sort_alliance = BALL_NONE;
+  color_sort_alliance_set((ball_color)color_sort_alliance);
+}
+
+bool config_save() {
+  config_bind();
+  if (!ez::util::SD_CARD_ACTIVE) {
+    printf("Config not saved, no SD card\n");
+    return false;
+  }
+
+  size_t length = store.write(config_buffer, sizeof(config_buffer));
+  if (length == 0) return false;
+  FILE* file = fopen(CONFIG_FILE, "w");
+  if (file == nullptr) return false;
+  bool written = fwrite(config_buffer, 1, length, file) == length;
+  fclose(file);
+  printf("Saved %i settings to %s\n", store.count_get(), CONFIG_FILE);
+  return written;
+}
+
+// Turn constants when the tuner was turned on, the schedule may have been writing them
+static ez::PID::Constants turn_before_tuning;
+
+static bool constants_equal(const ez::PID::Constants& a, const ez::PID::Constants& b) {
+  return a.kp == b.kp && a.ki == b.ki && a.kd == b.kd && a.start_i == b.start_i;
+}
+
+// Tuned constants are what ran at today's battery, saved ones are for NOMINAL_VOLTAGE
+static ez::PID::Constants uncompensated(const ez::PID& pid) {
+  return voltage_scale_constants(pid.constants, 1.0 / gain_compensate_scale_get());
+}
+
+void config_save_tuned() {
+  // The PIDs the tuner edits
+  tuning.drive = uncompensated(chassis.fwd_rev_drivePID);
+  tuning.heading = uncompensated(chassis.headingPID);
+  if (!tuning.turn_scheduled || !constants_equal(chassis.turnPID.constants, turn_before_tuning)) {
+    tuning.turn = uncompensated(chassis.turnPID);
+    tuning.turn_scheduled = 0;
+    gain_compensate_add(&chassis.turnPID, &tuning.turn);
+  }
+  tuning.swing = uncompensated(chassis.fwd_rev_swingPID);
+  tuning.odom_angular = uncompensated(chassis.odom_angularPID);
+  tuning.boomerang = uncompensated(chassis.boomerangPID);
+  config_save();
+}
+
+void config_tuner_toggle() {
+  // Pause the schedule so constants hold still while the tuner picks them up or lets go
+  bool scheduling = gain_schedule_enabled();
+  gain_schedule_enable(false);
+  if (chassis.pid_tuner_enabled()) {
+    chassis.pid_tuner_disable();
+    config_save_tuned();
+  } else {
+    turn_before_tuning = chassis.turnPID.constants_get();
+    chassis.pid_tuner_enable();
+  }
+  gain_schedule_enable(scheduling);
+}
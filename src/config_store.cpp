@@ -0,0 +1,124 @@
+#include "config_store.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+ConfigStore::ConfigStore(int version) : version(version) {}
+
+bool ConfigStore::bind(const char* key, double* number, int* integer) {
+  size_t length = strlen(key);
+  if (count >= KEYS_MAX || find(key, length) != nullptr) return false;
+
+  // Insert in hash order
+  uint32_t hash = config_hash(key, length);
+  int i = count;
+  while (i > 0 && bindings[i - 1].hash > hash) {
+    bindings[i] = bindings[i - 1];
+    i--;
+  }
+  bindings[i] = {hash, key, number, integer, count};
+  count++;
+  return true;
+}
+
+bool ConfigStore::add(const char* key, double* value) { return bind(key, value, nullptr); }
+
+bool ConfigStore::add(const char* key, int* value) { return bind(key, nullptr, value); }
+
+const ConfigStore::binding* ConfigStore::find(const char* key, size_t length) const {
+  uint32_t hash = config_hash(key, length);
+  int low = 0, high = count;
+  while (low < high) {
+    int middle = (low + high) / 2;
+    if (bindings[middle].hash < hash)
+      low = middle + 1;
+    else
+      high = middle;
+  }
+
+  // Keys that collide sit next to each other
+  for (int i = low; i < count && bindings[i].hash == hash; i++) {
+    if (strncmp(bindings[i].key, key, length) == 0 && bindings[i].key[length] == '\0') return &bindings[i];
+  }
+  return nullptr;
+}
+
+static bool is_space(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+ConfigStore::load_result ConfigStore::parse(const char* text) {
+  load_result result = {-1, false, 0, 0, 0};
+  const char* line = text;
+  while (*line != '\0') {
+    const char* end = strchr(line, '\n');
+    if (end == nullptr) end = line + strlen(line);
+    const char* next = *end == '\0' ? end : end + 1;
+
+    // Trim the key and skip blank lines and comments
+    const char* key = line;
+    while (key < end && is_space(*key)) key++;
+    if (key == end || *key == '#') {
+      line = next;
+      continue;
+    }
+    const char* equals = (const char*)memchr(key, '=', end - key);
+    if (equals == nullptr) {
+      result.bad++;
+      line = next;
+      continue;
+    }
+    const char* key_end = equals;
+    while (key_end > key && is_space(key_end[-1])) key_end--;
+    size_t key_length = key_end - key;
+
+    char* number_end;
+    double value = strtod(equals + 1, &number_end);
+    while (number_end < end && is_space(*number_end)) number_end++;
+    if (number_end == equals + 1 || number_end != end) {
+      result.bad++;
+      line = next;
+      continue;
+    }
+
+    // The version has to come first, and nothing after a mismatch gets loaded
+    if (result.version == -1) {
+      if (key_length != 7 || strncmp(key, "version", 7) != 0) return result;
+      if (value != std::trunc(value) || std::fabs(value) > 1e9) return result;  // Rounding 1.5 could match
+      result.version = value;
+      if (result.version != version) return result;
+      result.accepted = true;
+      line = next;
+      continue;
+    }
+
+    const binding* setting = find(key, key_length);
+    if (setting == nullptr) {
+      result.unknown++;
+    } else {
+      if (setting->number != nullptr) *setting->number = value;
+      if (setting->integer != nullptr) *setting->integer = value;
+      result.loaded++;
+    }
+    line = next;
+  }
+  return result;
+}
+
+size_t ConfigStore::write(char* buffer, size_t size) const {
+  size_t length = snprintf(buffer, size, "version=%i\n", version);
+  if (length >= size) return 0;
+
+  for (int order = 0; order < count; order++) {
+    for (int i = 0; i < count; i++) {
+      if (bindings[i].order != order) continue;
+      const binding& setting = bindings[i];
+      if (setting.number != nullptr)
+        length += snprintf(buffer + length, size - length, "%s=%.6g\n", setting.key, *setting.number);
+      else
+        length += snprintf(buffer + length, size - length, "%s=%i\n", setting.key, *setting.integer);
+      if (length >= size) return 0;
+    }
+  }
+  return length;
+}
@@ -0,0 +1,33 @@
+#include "main.h"
+
+static controller_frame current_frame;
+static controller_frame last_frame;
+
+static uint16_t button_bit(pros::controller_digital_e_t button) {
+  return 1 << (button - DIGITAL_L1);
+}
+
+controller_frame controller_read() {
+  controller_frame frame;
+  for (int i = 0; i < 4; i++)
+    frame.axes[i] = master.get_analog((pros::controller_analog_e_t)i);
+  for (int b = DIGITAL_L1; b <= DIGITAL_A; b++)
+    if (master.get_digital((pros::controller_digital_e_t)b)) frame.buttons |= button_bit((pros::controller_digital_e_t)b);
+  frame.state = get_current_state();
+  return frame;
+}
+
+void input_update(const controller_frame& frame) {
+  last_frame = current_frame;
+  current_frame = frame;
+}
+
+const controller_frame& input_get() { return current_frame; }
+
+int input_analog(pros::controller_analog_e_t channel) { return current_frame.axes[channel]; }
+
+bool input_digital(pros::controller_digital_e_t button) { return current_frame.buttons & button_bit(button); }
+
+bool input_digital_new_press(pros::controller_digital_e_t button) {
+  return (current_frame.buttons & button_bit(button)) && !(last_frame.buttons & button_bit(button));
+}
@@ -0,0 +1,49 @@
+#include "main.h"
+
+#include <cstdarg>
+
+static ControllerQueue controller_queue;
+static pros::Mutex controller_mutex;
+
+void controller_print(int line, int priority, const char* format, ...) {
+  char text[ControllerQueue::TEXT_SIZE];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+
+  controller_mutex.take();
+  controller_queue.text(line, priority, text);
+  controller_mutex.give();
+}
+
+void controller_rumble(const char* pattern, int priority) {
+  controller_mutex.take();
+  controller_queue.rumble(priority, pattern);
+  controller_mutex.give();
+}
+
+static TaskProfile controller_profile("controller");
+
+void controller_task() {
+  controller_profile.start();
+  uint32_t now = pros::millis();
+  while (true) {
+    controller_profile.begin();
+    ControllerQueue::message message;
+    controller_mutex.take();
+    bool ready = controller_queue.pop(message);
+    controller_mutex.give();
+
+    if (ready) {
+      if (message.slot == ControllerQueue::RUMBLE)
+        master.rumble(message.text);
+      else
+        master.set_text(message.slot, 0, message.text);
+    }
+
+    controller_profile.end();
+    pros::Task::delay_until(&now, controller_send_time);
+  }
+}
+pros::Task controllerTask(controller_task, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_DEFAULT, "controller");
@@ -0,0 +1,43 @@
+#include "controller_queue.hpp"
+
+#include <cstdio>
+
+void ControllerQueue::queue(int slot, int priority, const char* text) {
+  // A message that's still waiting keeps its place in line but takes the higher priority
+  if (waiting[slot] && slots[slot].priority > priority) priority = slots[slot].priority;
+  if (!waiting[slot]) sequence[slot] = next_sequence++;
+
+  slots[slot].slot = slot;
+  slots[slot].priority = priority;
+  snprintf(slots[slot].text, TEXT_SIZE, "%s", text);
+  waiting[slot] = true;
+}
+
+void ControllerQueue::text(int line, int priority, const char* text) {
+  if (line < 0 || line >= LINES) return;
+  queue(line, priority, text);
+}
+
+void ControllerQueue::rumble(int priority, const char* pattern) { queue(RUMBLE, priority, pattern); }
+
+bool ControllerQueue::pop(message& out) {
+  int next = -1;
+  for (int slot = 0; slot <= LINES; slot++) {
+    if (!waiting[slot]) continue;
+    if (next == -1 || slots[slot].priority > slots[next].priority ||
+        (slots[slot].priority == slots[next].priority && (int)(sequence[slot] - sequence[next]) < 0)) {
+      next = slot;
+    }
+  }
+  if (next == -1) return false;
+
+  out = slots[next];
+  waiting[next] = false;
+  return true;
+}
+
+int ControllerQueue::pending_get() const {
+  int count = 0;
+  for (int slot = 0; slot <= LINES; slot++) count += waiting[slot];
+  return count;
+}
@@ -1,14 +1,36 @@
-#include "conveyor.hpp"
+#include "main.h"
 
-// For middle goals
-const int slow_speed = 40;
-// For long goals
-const int fast_speed = 100;
+static JamDetector bottom_jam;
+static JamDetector top_jam;
+
+// kV is 127 power over the 200 rpm free speed
+static VelocityController bottom_velocity(0.635, 4.0, ez::PID(0.4, 0.01, 0.0, 60.0, "Bottom Conveyor"));
+static VelocityController top_velocity(0.635, 4.0, ez::PID(0.4, 0.01, 0.0, 60.0, "Top Conveyor"));
+
+double conveyor_bps_to_rpm(double bps) {
+  return bps * conveyor_ball_spacing / conveyor_travel_per_rev * 60.0;
+}
+
+static void stage_set(SubsystemMotors& stage, JamDetector& jam, double input) {
+  stage.move(jam.iterate(input, stage.velocity_get(), stage.current_get(), pros::millis()));
+}
 
 void set_bottom_conveyor(int input) {
-    
-};
-void set_top_conveyor(int input);
+  bottom_velocity.reset();
+  stage_set(bottom_conveyor, bottom_jam, input);
+}
+
+void set_top_conveyor(int input) {
+  top_velocity.reset();
+  stage_set(top_conveyor, top_jam, input);
+}
+
+void set_conveyor_throughput(double bps) {
+  double rpm = conveyor_bps_to_rpm(bps);
+  stage_set(bottom_conveyor, bottom_jam, bottom_velocity.iterate(rpm, bottom_conveyor.velocity_get()));
+  stage_set(top_conveyor, top_jam, top_velocity.iterate(rpm, top_conveyor.velocity_get()));
+}
 
-pros::Task bottom_conveyor_task();
-pros::Task top_conveyor_task();
\ No newline at end of file
+int conveyor_jams_get() {
+  return bottom_jam.jams_get() + top_jam.jams_get();
+}
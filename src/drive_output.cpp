@@ -0,0 +1,48 @@
+#include "main.h"
+
+// At 10 ms per sample this settles in about half a second, long enough to ignore sag from a single acceleration
+static const double BATTERY_FILTER_ALPHA = 0.02;
+static double battery_filtered = 0.0;
+
+double battery_voltage_get() {
+  if (battery_filtered == 0.0) battery_filtered = pros::battery::get_voltage();
+  return battery_filtered;
+}
+
+void battery_filter_iterate() {
+  double reading = pros::battery::get_voltage();
+  if (reading <= 0) return;  // Failed reads return errors, don't filter them in
+  if (battery_filtered == 0.0)
+    battery_filtered = reading;
+  else
+    battery_filtered += (reading - battery_filtered) * BATTERY_FILTER_ALPHA;
+}
+
+int voltage_compensate(double input) {
+  // V5 motors treat 12000 as full duty cycle of whatever the battery currently is
+  double output = (input / 127.0) * 12000.0 * voltage_scale(NOMINAL_VOLTAGE, battery_voltage_get());
+  return ez::util::clamp(output, 12000);
+}
+
+void drive_output_set(double left, double right) {
+  TIME_SCOPE("drive_output_set");
+  int l = voltage_compensate(left);
+  int r = voltage_compensate(right);
+  for (auto& motor : chassis.left_motors)
+    if (!chassis.pto_check(motor)) motor.move_voltage(l);
+  for (auto& motor : chassis.right_motors)
+    if (!chassis.pto_check(motor)) motor.move_voltage(r);
+}
+
+static TaskProfile battery_filter_profile("battery");
+
+void battery_filter_task() {
+  battery_filter_profile.start();
+  while (true) {
+    battery_filter_profile.begin();
+    battery_filter_iterate();
+    battery_filter_profile.end();
+    pros::delay(ez::util::DELAY_TIME);
+  }
+}
+pros::Task batteryFilterTask(battery_filter_task);
@@ -0,0 +1,30 @@
+#include "field_map.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+FieldTransform::FieldTransform(double field_size, int pixels)
+    : half_field(field_size / 2.0), pixels(pixels), scale(pixels / field_size) {}
+
+map_point FieldTransform::to_pixel(double x, double y) const {
+  int px = std::lround((x + half_field) * scale);
+  int py = std::lround((half_field - y) * scale);
+  return {(int16_t)std::clamp(px, 0, pixels - 1), (int16_t)std::clamp(py, 0, pixels - 1)};
+}
+
+double FieldTransform::scale_get() const { return scale; }
+
+TrailDecimator::TrailDecimator(int min_pixels) : min_pixels(min_pixels) {}
+
+bool TrailDecimator::keep(map_point point) {
+  if (started) {
+    int dx = point.x - last.x;
+    int dy = point.y - last.y;
+    if (dx * dx + dy * dy < min_pixels * min_pixels) return false;
+  }
+  started = true;
+  last = point;
+  return true;
+}
+
+void TrailDecimator::reset() { started = false; }
@@ -0,0 +1,132 @@
+#include "main.h"
+
+#include "liblvgl/lvgl.h"
+
+static const int MAP_SIZE = 200;  // px, the brain screen is 480 x 240
+static const int MAP_X = 270;
+static const int MAP_Y = 30;
+static const int MAX_PATH_POINTS = 32;
+static const int TRAIL_CHUNKS = 8;
+static const int CHUNK_POINTS = 16;
+
+static FieldTransform field_transform(144.0, MAP_SIZE);
+static TrailDecimator trail_decimator(3);
+
+static lv_obj_t* map_area = nullptr;
+static lv_obj_t* path_line = nullptr;
+static lv_obj_t* robot_marker = nullptr;
+static lv_obj_t* look_ahead_marker = nullptr;
+static lv_obj_t* trail_lines[TRAIL_CHUNKS] = {};
+
+// LVGL keeps pointers to these, so they have to live as long as the lines do
+static lv_point_t path_points[MAX_PATH_POINTS];
+static lv_point_t trail_points[TRAIL_CHUNKS][CHUNK_POINTS];
+static int trail_counts[TRAIL_CHUNKS] = {};
+static int trail_chunk = 0;
+
+static int drawn_path_version = -1;
+static map_point drawn_robot = {-1, -1};
+static map_point drawn_look_ahead = {-1, -1};
+
+static lv_obj_t* marker_create(lv_color_t color, int size) {
+  lv_obj_t* marker = lv_obj_create(map_area);
+  lv_obj_set_size(marker, size, size);
+  lv_obj_set_style_radius(marker, LV_RADIUS_CIRCLE, 0);
+  lv_obj_set_style_bg_color(marker, color, 0);
+  lv_obj_set_style_border_width(marker, 0, 0);
+  lv_obj_clear_flag(marker, LV_OBJ_FLAG_SCROLLABLE);
+  return marker;
+}
+
+static lv_obj_t* line_create(lv_color_t color, int width) {
+  lv_obj_t* line = lv_line_create(map_area);
+  lv_obj_set_style_line_color(line, color, 0);
+  lv_obj_set_style_line_width(line, width, 0);
+  return line;
+}
+
+static void map_create() {
+  map_area = lv_obj_create(lv_scr_act());
+  lv_obj_set_pos(map_area, MAP_X, MAP_Y);
+  lv_obj_set_size(map_area, MAP_SIZE, MAP_SIZE);
+  lv_obj_set_style_pad_all(map_area, 0, 0);
+  lv_obj_set_style_radius(map_area, 0, 0);
+  lv_obj_set_style_bg_color(map_area, lv_color_hex(0x505050), 0);
+  lv_obj_set_style_border_color(map_area, lv_color_hex(0xFFFFFF), 0);
+  lv_obj_set_style_border_width(map_area, 1, 0);
+  lv_obj_clear_flag(map_area, LV_OBJ_FLAG_SCROLLABLE);
+
+  for (int i = 0; i < TRAIL_CHUNKS; i++) trail_lines[i] = line_create(lv_color_hex(0x00C0FF), 2);
+  path_line = line_create(lv_color_hex(0xFFFF00), 1);
+  look_ahead_marker = marker_create(lv_color_hex(0xFF00FF), 6);
+  robot_marker = marker_create(lv_color_hex(0xFFFFFF), 10);
+}
+
+static void marker_move(lv_obj_t* marker, map_point point, int size) {
+  lv_obj_set_pos(marker, point.x - size / 2, point.y - size / 2);
+}
+
+static bool same_point(map_point a, map_point b) { return a.x == b.x && a.y == b.y; }
+
+// Adds a point to the trail, touching only the chunk it lands in
+static void trail_add(map_point point) {
+  if (trail_counts[trail_chunk] == CHUNK_POINTS) {
+    // Start the next chunk where this one ends so the trail stays connected, reusing the oldest one
+    lv_point_t last = trail_points[trail_chunk][CHUNK_POINTS - 1];
+    trail_chunk = (trail_chunk + 1) % TRAIL_CHUNKS;
+    trail_points[trail_chunk][0] = last;
+    trail_counts[trail_chunk] = 1;
+  }
+  trail_points[trail_chunk][trail_counts[trail_chunk]] = {point.x, point.y};
+  trail_counts[trail_chunk]++;
+  lv_line_set_points(trail_lines[trail_chunk], trail_points[trail_chunk], trail_counts[trail_chunk]);
+}
+
+void field_map_draw() {
+  TIME_SCOPE("field_map_draw");
+  if (map_area == nullptr) map_create();
+  lv_obj_clear_flag(map_area, LV_OBJ_FLAG_HIDDEN);
+
+  int budget = field_map_draw_budget;
+
+  // The robot first, it's what's most useful to see move
+  map_point robot = field_transform.to_pixel(chassis.odom_x_get(), chassis.odom_y_get());
+  if (!same_point(robot, drawn_robot) && budget > 0) {
+    marker_move(robot_marker, robot, 10);
+    drawn_robot = robot;
+    budget--;
+  }
+
+  if (budget > 0 && trail_decimator.keep(robot)) {
+    trail_add(robot);
+    budget--;
+  }
+
+  // The path only changes when a new one is set
+  int version = path_version_get();
+  if (version != drawn_path_version && budget > 0) {
+    path_point points[MAX_PATH_POINTS];
+    int count = path_points_get(points, MAX_PATH_POINTS);
+    for (int i = 0; i < count; i++) {
+      map_point pixel = field_transform.to_pixel(points[i].x, points[i].y);
+      path_points[i] = {pixel.x, pixel.y};
+    }
+    lv_line_set_points(path_line, path_points, count);
+    drawn_path_version = version;
+    budget--;
+  }
+
+  if (drawn_path_version > 0 && budget > 0) {
+    path_point look_ahead = path_lookahead_get();
+    map_point pixel = field_transform.to_pixel(look_ahead.x, look_ahead.y);
+    if (!same_point(pixel, drawn_look_ahead)) {
+      marker_move(look_ahead_marker, pixel, 6);
+      drawn_look_ahead = pixel;
+      budget--;
+    }
+  }
+}
+
+void field_map_hide() {
+  if (map_area != nullptr) lv_obj_add_flag(map_area, LV_OBJ_FLAG_HIDDEN);
+}
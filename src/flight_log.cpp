@@ -0,0 +1,60 @@
+#include "flight_log.hpp"
+
+#include <cstring>
+
+void FlightRing::push(const flight_sample& sample) {
+  samples[next] = sample;
+  next = (next + 1) % SAMPLES;
+  if (count < SAMPLES) count++;
+}
+
+const flight_sample& FlightRing::at(int index) const {
+  int oldest = (next - count + SAMPLES) % SAMPLES;
+  return samples[(oldest + index) % SAMPLES];
+}
+
+void FlightRing::clear() {
+  next = 0;
+  count = 0;
+}
+
+bool flight_log_write(FILE* out, const FlightRing& ring, flight_reason reason, int period, uint32_t now) {
+  flight_log_header header;
+  memcpy(header.magic, FLIGHT_LOG_MAGIC, sizeof(header.magic));
+  header.version = FLIGHT_LOG_VERSION;
+  header.reason = reason;
+  header.period = period;
+  header.count = ring.count_get();
+  header.time = now;
+  if (fwrite(&header, sizeof(header), 1, out) != 1) return false;
+
+  // The ring wraps, so this is at most two contiguous runs, but samples are small and this only
+  // runs when something went wrong
+  for (int i = 0; i < ring.count_get(); i++) {
+    if (fwrite(&ring.at(i), sizeof(flight_sample), 1, out) != 1) return false;
+  }
+  return true;
+}
+
+bool flight_log_read_header(FILE* in, flight_log_header& header) {
+  if (fread(&header, sizeof(header), 1, in) != 1) return false;
+  if (memcmp(header.magic, FLIGHT_LOG_MAGIC, sizeof(header.magic)) != 0) return false;
+  return header.version == FLIGHT_LOG_VERSION;
+}
+
+const char* flight_reason_to_string(uint8_t reason) {
+  switch (reason) {
+    case FLIGHT_DISABLED:
+      return "disabled";
+    case FLIGHT_INTERFERED:
+      return "interfered";
+    case FLIGHT_LOW_BATTERY:
+      return "low battery";
+    case FLIGHT_JAM:
+      return "jam";
+    case FLIGHT_MANUAL:
+      return "manual";
+    default:
+      return "unknown";
+  }
+}
@@ -0,0 +1,128 @@
+#include "main.h"
+
+static FlightRing flight_ring;
+static std::atomic<int> flush_request{0};  // flight_reason, 0 when nothing's been asked for
+static bool active = false;                // The robot has been enabled since the last log
+static int logs = 0;
+static int next_file = -1;
+
+// Logs go round flight00 to flight99.  The next one to write is kept on the card so after a wrap
+// a restart overwrites the oldest log instead of the first
+static const int FLIGHT_FILES = 100;
+static const char* FLIGHT_NEXT_FILE = "/usd/flight_next.txt";
+
+void flight_recorder_flush(flight_reason reason) {
+  int none = 0;
+  flush_request.compare_exchange_strong(none, reason);  // The first reason wins
+}
+
+int flight_recorder_logs_get() { return logs; }
+
+static void flight_sample_fill(flight_sample& sample) {
+  sample.time = pros::millis();
+
+  sample.x = chassis.odom_x_get();
+  sample.y = chassis.odom_y_get();
+  sample.theta = chassis.odom_theta_get();
+
+  sample.drive_mode = chassis.drive_mode_get();
+  sample.left_voltage = chassis.left_motors[0].get_voltage();
+  sample.right_voltage = chassis.right_motors[0].get_voltage();
+  sample.left_current = chassis.drive_mA_left();
+  sample.right_current = chassis.drive_mA_right();
+
+  sample.subsystem_state = subsystem_state_get();
+  sample.intake_current = intake_motors.current_get();
+  sample.bottom_current = bottom_conveyor.current_get();
+  sample.top_current = top_conveyor.current_get();
+  sample.outtake_current = outtake.current_get();
+
+  sample.battery = battery_voltage_get();
+  sample.flags = 0;
+  if (!pros::competition::is_disabled()) sample.flags |= FLIGHT_FLAG_ENABLED;
+  if (pros::competition::is_autonomous()) sample.flags |= FLIGHT_FLAG_AUTONOMOUS;
+  if (chassis.interfered) sample.flags |= FLIGHT_FLAG_INTERFERED;
+}
+
+// Fault checks, each only fires on the tick it starts
+static void flight_faults_check(const flight_sample& sample) {
+  static bool was_interfered = false;
+  static bool was_low = false;
+  static int last_jams = 0;
+
+  bool interfered = sample.flags & FLIGHT_FLAG_INTERFERED;
+  if (interfered && !was_interfered) flight_recorder_flush(FLIGHT_INTERFERED);
+  was_interfered = interfered;
+
+  bool low = sample.battery > 0 && sample.battery < flight_low_battery;
+  if (low && !was_low) flight_recorder_flush(FLIGHT_LOW_BATTERY);
+  was_low = low;
+
+  int jams = conveyor_jams_get();
+  if (jams > last_jams) flight_recorder_flush(FLIGHT_JAM);
+  last_jams = jams;
+}
+
+static void flight_log_save(flight_reason reason) {
+  if (!ez::util::SD_CARD_ACTIVE) {
+    printf("Flight log not saved, no SD card\n");
+    return;
+  }
+
+  // Find where to start once, then count up from there
+  char name[24];
+  if (next_file < 0) {
+    FILE* next = fopen(FLIGHT_NEXT_FILE, "r");
+    if (next != nullptr) {
+      if (fscanf(next, "%d", &next_file) != 1 || next_file < 0 || next_file >= FLIGHT_FILES) next_file = -1;
+      fclose(next);
+    }
+  }
+  if (next_file < 0) {
+    // No index yet, cards from before it was kept start at the first unused name
+    next_file = 0;
+    while (next_file < FLIGHT_FILES - 1) {
+      snprintf(name, sizeof(name), "/usd/flight%02d.bin", next_file);
+      FILE* existing = fopen(name, "rb");
+      if (existing == nullptr) break;
+      fclose(existing);
+      next_file++;
+    }
+  }
+  snprintf(name, sizeof(name), "/usd/flight%02d.bin", next_file);
+  next_file = (next_file + 1) % FLIGHT_FILES;
+  FILE* next = fopen(FLIGHT_NEXT_FILE, "w");
+  if (next != nullptr) {
+    fprintf(next, "%d\n", next_file);
+    fclose(next);
+  }
+
+  FILE* file = fopen(name, "wb");
+  if (file == nullptr) return;
+  bool written = flight_log_write(file, flight_ring, reason, flight_recorder_period, pros::millis());
+  fclose(file);
+
+  logs++;
+  printf("%s flight log %s to %s\n", flight_reason_to_string(reason), written ? "saved" : "partly saved", name);
+}
+
+void flight_recorder_task() {
+  static flight_sample sample = {};
+  uint32_t now = pros::millis();
+  while (true) {
+    flight_sample_fill(sample);
+    flight_ring.push(sample);
+    if (sample.flags & FLIGHT_FLAG_ENABLED) active = true;
+    flight_faults_check(sample);
+
+    // Writing takes a while, the gap this leaves in the samples will show up in their times
+    int reason = flush_request.exchange(0);
+    if (reason != 0 && active) {
+      flight_log_save((flight_reason)reason);
+      active = false;
+    }
+
+    pros::Task::delay_until(&now, flight_recorder_period);
+  }
+}
+pros::Task flightRecorderTask(flight_recorder_task, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_DEFAULT, "flight recorder");
@@ -0,0 +1,154 @@
+#include "main.h"
+
+struct scheduled_pid {
+  ez::PID* pid;
+  GainSchedule schedule;
+  std::function<double()> sensor;
+  double last_target;
+  double magnitude;
+};
+
+struct compensated_pid {
+  ez::PID* pid;
+  const ez::PID::Constants* base;
+};
+
+static std::vector<scheduled_pid> scheduled;
+static std::vector<compensated_pid> compensated;
+static pros::Mutex scheduled_mutex;  // gain_schedule_add can run while the task is iterating
+static bool schedule_on = true;
+static double compensate_scale = 1.0;
+
+// What EZ-Template is running, a change means a motion just started
+struct motion_key {
+  int mode;
+  double left, right, turn, swing;
+  bool operator==(const motion_key&) const = default;
+};
+static motion_key motion_last = {-1, 0, 0, 0, 0};
+static bool motion_started = false;
+
+static int speed_requested = -1;  // Max speed the auton asked for
+static int speed_written = -1;    // Scaled max speed written for it
+
+// Only targets that stay put for the whole motion are part of it.  Odom motions move their targets
+// every tick, so back to back odom motions of the same kind are only told apart by their speed
+static motion_key motion_current() {
+  int mode = chassis.drive_mode_get();
+  motion_key key = {mode, 0, 0, 0, 0};
+  if (mode == ez::DRIVE) {
+    key.left = chassis.leftPID.target_get();
+    key.right = chassis.rightPID.target_get();
+  } else if (mode == ez::TURN) {
+    key.turn = chassis.turnPID.target_get();
+  } else if (mode == ez::SWING) {
+    key.swing = chassis.swingPID.target_get();
+  }
+  return key;
+}
+
+template <typename T>
+static void pid_erase(std::vector<T>& list, ez::PID* pid) {
+  for (size_t i = 0; i < list.size(); i++) {
+    if (list[i].pid == pid) {
+      list.erase(list.begin() + i);
+      return;
+    }
+  }
+}
+
+void gain_schedule_add(ez::PID* pid, const GainSchedule& schedule, std::function<double()> sensor) {
+  scheduled_mutex.take();
+  bool replaced = false;
+  for (auto& s : scheduled) {
+    if (s.pid == pid) {
+      s = {pid, schedule, sensor, pid->target_get(), 0.0};
+      replaced = true;
+    }
+  }
+  if (!replaced) scheduled.push_back({pid, schedule, sensor, pid->target_get(), 0.0});
+  pid_erase(compensated, pid);
+  scheduled_mutex.give();
+}
+
+void gain_compensate_add(ez::PID* pid, const ez::PID::Constants* base) {
+  scheduled_mutex.take();
+  pid_erase(scheduled, pid);
+  pid_erase(compensated, pid);
+  compensated.push_back({pid, base});
+  scheduled_mutex.give();
+}
+
+double gain_compensate_scale_get() { return compensate_scale; }
+
+int gain_compensate_speed_requested_get() { return speed_requested; }
+
+int gain_compensate_speed_written_get() { return speed_written; }
+
+void gain_schedule_remove(ez::PID* pid) {
+  scheduled_mutex.take();
+  pid_erase(scheduled, pid);
+  pid_erase(compensated, pid);
+  scheduled_mutex.give();
+}
+
+// Changed under the lock so nothing is mid-write when scheduling is turned off
+void gain_schedule_enable(bool enable) {
+  scheduled_mutex.take();
+  schedule_on = enable;
+  scheduled_mutex.give();
+}
+bool gain_schedule_enabled() { return schedule_on; }
+
+void gain_schedule_iterate() {
+  TIME_SCOPE("gain_schedule_iterate");
+  double voltage = battery_voltage_get();
+  scheduled_mutex.take();
+  if (!schedule_on || chassis.pid_tuner_enabled()) {
+    scheduled_mutex.give();
+    return;
+  }
+  for (auto& s : scheduled) {
+    // A new target is a new motion, so remember how big it is
+    double target = s.pid->target_get();
+    if (target != s.last_target) {
+      s.magnitude = fabs(target - s.sensor());
+      s.last_target = target;
+    }
+    s.pid->constants = s.schedule.get(s.magnitude, voltage);
+  }
+
+  // Outputs scaled so they give the voltage they would at NOMINAL_VOLTAGE
+  compensate_scale = voltage_scale(NOMINAL_VOLTAGE, voltage);
+  for (auto& c : compensated) c.pid->constants = voltage_scale_constants(*c.base, compensate_scale);
+
+  // The max speed is scaled once when a motion starts, rewriting it during the motion would restart
+  // slew.  The start is seen a tick late so the pid_*_set() that started it has finished writing the
+  // speed, and a speed that isn't the one written last was asked for during the motion, by the auton
+  // or by a pure pursuit point.  This task outranks the auton and EZ-Template's motion task, so
+  // neither runs between reading the speed and writing it
+  motion_key motion = motion_current();
+  bool started = motion_started;
+  motion_started = !(motion == motion_last);
+  motion_last = motion;
+  int speed = chassis.pid_speed_max_get();
+  if (!motion_started && (started || speed != speed_written)) {
+    speed_requested = speed;
+    speed_written = voltage_scale_speed(speed_requested, compensate_scale);
+    if (speed_written != speed) chassis.pid_speed_max_set(speed_written);
+  }
+  scheduled_mutex.give();
+}
+
+static TaskProfile gain_schedule_profile("gains");
+
+void gain_schedule_task() {
+  gain_schedule_profile.start();
+  while (true) {
+    gain_schedule_profile.begin();
+    gain_schedule_iterate();
+    gain_schedule_profile.end();
+    pros::delay(ez::util::DELAY_TIME);
+  }
+}
+pros::Task gainScheduleTask(gain_schedule_task, TASK_PRIORITY_DEFAULT + 1, TASK_STACK_DEPTH_DEFAULT, "gains");
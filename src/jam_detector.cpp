@@ -0,0 +1,47 @@
+#include "jam_detector.hpp"
+
+#include <cmath>
+
+JamDetector::JamDetector() {}
+JamDetector::JamDetector(Constants constants) : constants(constants) {}
+
+double JamDetector::iterate(double command, double velocity, double current, int now) {
+  switch (current_phase) {
+    case REVERSING:
+      if (now < phase_end) return -jam_direction * constants.reverse_power;
+      current_phase = RECOVERING;
+      phase_end = now + constants.recover_time;
+      return command;
+
+    case RECOVERING:
+      if (now < phase_end) return command;
+      current_phase = RUNNING;
+      stall_start = -1;
+      break;
+
+    case RUNNING:
+      break;
+  }
+
+  bool stalled = std::fabs(command) >= constants.min_power &&
+                 std::fabs(velocity) < constants.stall_velocity &&
+                 current >= constants.stall_current;
+  if (!stalled) {
+    stall_start = -1;
+    return command;
+  }
+
+  if (stall_start < 0) stall_start = now;
+  if (now - stall_start < constants.window) return command;
+
+  // Jammed, back the belt off
+  jams++;
+  jam_direction = command > 0 ? 1 : -1;
+  current_phase = REVERSING;
+  phase_end = now + constants.reverse_time;
+  return -jam_direction * constants.reverse_power;
+}
+
+bool JamDetector::unjamming() const { return current_phase == REVERSING; }
+
+int JamDetector::jams_get() const { return jams; }
@@ -0,0 +1,72 @@
+#include "main.h"
+
+// Matches EZ-Template's curve buttons, one step per press and repeating while held
+static const double CURVE_STEP = 0.1;
+static const int HOLD_START = 500;  // ms before a held button starts repeating
+static const int HOLD_REPEAT = 100;  // ms between repeats
+
+static bool curves_loaded = false;
+
+// Same files EZ-Template's opcontrol_curve_sd_initialize() reads at boot
+static const char* LEFT_CURVE_FILE = "/usd/left_curve.txt";
+static const char* RIGHT_CURVE_FILE = "/usd/right_curve.txt";
+static bool left_changed = false, right_changed = false;
+
+static void curve_save(const char* name, double scale) {
+  if (!ez::util::SD_CARD_ACTIVE) return;
+  FILE* file = fopen(name, "w");
+  if (file == nullptr) return;
+  fprintf(file, "%.2f", scale);
+  fclose(file);
+}
+
+// Returns how many steps a pair of buttons moved this tick
+static int curve_button_steps(std::vector<pros::controller_digital_e_t> buttons, int& held_time) {
+  int decrease = input_digital(buttons[0]);
+  int increase = input_digital(buttons[1]);
+  int direction = increase - decrease;
+  if (direction == 0) {
+    held_time = 0;
+    return 0;
+  }
+
+  held_time += ez::util::DELAY_TIME;
+  if (held_time == ez::util::DELAY_TIME) return direction;
+  if (held_time >= HOLD_START && (held_time - HOLD_START) % HOLD_REPEAT == 0) return direction;
+  return 0;
+}
+
+void joystick_curve_buttons_iterate() {
+  // Start from the defaults given to chassis
+  if (!curves_loaded) {
+    std::vector<double> defaults = chassis.opcontrol_curve_default_get();
+    left_curve.scale_set(defaults[0]);
+    right_curve.scale_set(defaults[1]);
+    curves_loaded = true;
+  }
+
+  if (!chassis.opcontrol_curve_buttons_toggle_get()) return;
+
+  static int left_held = 0, right_held = 0;
+  int left_steps = curve_button_steps(chassis.opcontrol_curve_buttons_left_get(), left_held);
+  int right_steps = curve_button_steps(chassis.opcontrol_curve_buttons_right_get(), right_held);
+  if (left_steps == 0 && right_steps == 0) {
+    // Save once the buttons are let go, not on every repeat while they're held
+    if (left_changed && left_held == 0) {
+      curve_save(LEFT_CURVE_FILE, left_curve.scale_get());
+      left_changed = false;
+    }
+    if (right_changed && right_held == 0) {
+      curve_save(RIGHT_CURVE_FILE, right_curve.scale_get());
+      right_changed = false;
+    }
+    return;
+  }
+
+  left_curve.scale_set(std::max(0.0, left_curve.scale_get() + left_steps * CURVE_STEP));
+  right_curve.scale_set(std::max(0.0, right_curve.scale_get() + right_steps * CURVE_STEP));
+  left_changed |= left_steps != 0;
+  right_changed |= right_steps != 0;
+
+  controller_print(2, PRIORITY_NORMAL, "%.1f    %.1f", left_curve.scale_get(), right_curve.scale_get());
+}
@@ -0,0 +1,51 @@
+#include "load_monitor.hpp"
+
+#include <algorithm>
+
+LoadMonitor::LoadMonitor() {}
+LoadMonitor::LoadMonitor(Constants constants) : constants(constants) {}
+
+void LoadMonitor::start(int new_target, int timeout, int now) {
+  target = new_target;
+  start_time = now;
+  end_time = now + timeout;
+  last_ball_time = now;
+  loaded = 0;
+  current_count = 0;
+  grabbing = false;
+  current_result = LOADING;
+}
+
+bool LoadMonitor::iterate(int entered, double current, bool full, int now) {
+  if (current_result != LOADING) return true;
+
+  // Every current bump is a ball being pulled in, once the intake is up to speed
+  bool spinning_up = now - start_time < constants.spin_up_time;
+  if (spinning_up) {
+    grabbing = false;
+  } else if (!grabbing && current > constants.current_enter) {
+    grabbing = true;
+    current_count++;
+  } else if (grabbing && current < constants.current_exit) {
+    grabbing = false;
+  }
+
+  int count = std::max(entered, current_count);
+  if (count > loaded) {
+    loaded = count;
+    last_ball_time = now;
+  }
+
+  if (loaded >= target || full)
+    current_result = FILLED;
+  else if (now - last_ball_time >= constants.dry_time)
+    current_result = DRY;
+  else if (now >= end_time)
+    current_result = TIMED_OUT;
+
+  return current_result != LOADING;
+}
+
+int LoadMonitor::loaded_get() const { return loaded; }
+
+LoadMonitor::result LoadMonitor::result_get() const { return current_result; }
@@ -23,6 +23,30 @@ ez::Drive chassis(
 // ez::tracking_wheel horiz_tracker(8, 2.75, 4.0);  // This tracking wheel is perpendicular to the drive wheels
 // ez::tracking_wheel vert_tracker(9, 2.75, 4.0);   // This tracking wheel is parallel to the drive wheels
 
+// Startup phases, these run at the same time so initialize() only takes as long as the slowest one it waits on
+static void imu_phase() {
+  chassis.drive_imu_calibrate(false);  // The loading animation would fight the selector for the screen
+  chassis.drive_sensor_reset();
+}
+static void config_phase() {
+  config_load();
+  default_constants();
+}
+static void selector_phase() { ez::as::initialize(); }
+static void curve_phase() { chassis.opcontrol_curve_sd_initialize(); }
+static void paths_phase() { path_plans_generate(); }
+static void subsystem_phase() {
+  pros::delay(500);  // Stop the user from doing anything while legacy ports configure
+  color_sort_initialize();
+}
+
+static BootPhase imu_boot("imu", imu_phase);
+static BootPhase config_boot("config", config_phase);
+static BootPhase selector_boot("selector", selector_phase, &config_boot);  // Both read the SD card, config is one small file
+static BootPhase curve_boot("curve", curve_phase, &selector_boot);  // Both read the SD card
+static BootPhase paths_boot("paths", paths_phase, &selector_boot);  // Needs the selected auton
+static BootPhase subsystem_boot("subsystems", subsystem_phase);
+
 /**
  * Runs initialization code. This occurs as soon as the program is started.
  *
@@ -30,11 +54,11 @@ ez::Drive chassis(
  * to keep execution time for this mode under a few seconds.
  */
 void initialize() {
+  boot_begin();
+
   // Print our branding over your terminal :D
   ez::ez_template_print();
 
-  pros::delay(500);  // Stop the user from doing anything while legacy ports configure
-
   // Look at your horizontal tracking wheel and decide if it's in front of the midline of your robot or behind it
   //  - change `back` to `front` if the tracking wheel is in front of the midline
   //  - ignore this if you aren't using a horizontal tracker
@@ -49,9 +73,6 @@ void initialize() {
   chassis.opcontrol_drive_activebrake_set(0.0);   // Sets the active brake kP. We recommend ~2.  0 will disable.
   chassis.opcontrol_curve_default_set(0.0, 0.0);  // Defaults for curve. If using tank, only the first parameter is used. (Comment this line out if you have an SD card!)
 
-  // Set the drive to your own constants from autons.cpp!
-  default_constants();
-
   // These are already defaulted to these buttons, but you can change the left/right curve buttons here!
   // chassis.opcontrol_curve_buttons_left_set(pros::E_CONTROLLER_DIGITAL_LEFT, pros::E_CONTROLLER_DIGITAL_RIGHT);  // If using tank, only the left side is used.
   // chassis.opcontrol_curve_buttons_right_set(pros::E_CONTROLLER_DIGITAL_Y, pros::E_CONTROLLER_DIGITAL_A);
@@ -72,13 +93,34 @@ void initialize() {
       {"Boomerang\n\nGo to (0, 24, 45) then come back to (0, 0, 0)", odom_boomerang_example},
       {"Boomerang Pure Pursuit\n\nGo to (0, 24, 45) on the way to (24, 24) then come back to (0, 0, 0)", odom_boomerang_injected_pure_pursuit_example},
       {"Measure Offsets\n\nThis will turn the robot a bunch of times and calculate your offsets for your tracking wheels.", measure_offsets},
+      {"Match Loader\n\nPush into the match loader and intake until full", [] { match_loader(); }},
       {"Test", skills_bottom_bot},
+      {"Replay\n\nPlays back the last driver recording from the SD card", recording_play},
   });
 
-  // Initialize chassis and auton selector
-  chassis.initialize();
-  ez::as::initialize();
-  master.rumble(chassis.drive_imu_calibrated() ? "." : "---");
+  // Subsystem motors stay off until this has checked their ports, and a group that clashes stays off
+  bool ports_valid = subsystem_ports_validate() == 0;
+
+  // telemetry_start();  // Streams binary telemetry over USB instead of printing, decode it with tools/telemetry_decode.cpp
+  // cpu_load_start();    // Measures the total CPU load for the task page, this takes spare CPU from priority 1 tasks
+
+  // Calibrate the IMU, set up the auton selector, and load the SD card at the same time.  The config
+  // phase sets the drive to your own constants from autons.cpp, or the SD card if they've been saved there
+  imu_boot.start();
+  config_boot.start();
+  selector_boot.start();
+  curve_boot.start();
+  paths_boot.start();
+  subsystem_boot.start();
+
+  // Autonomous needs the IMU, the constants, the selected auton and the subsystems, the curve only matters
+  // to the driver and a path that isn't ready yet is generated when its motion starts
+  imu_boot.join();
+  config_boot.join();
+  selector_boot.join();
+  subsystem_boot.join();
+  boot_end();
+  controller_rumble(chassis.drive_imu_calibrated() && ports_valid ? "." : "---");
 }
 
 /**
@@ -87,7 +129,11 @@ void initialize() {
  * the robot is enabled, this task will exit.
  */
 void disabled() {
-  // . . .
+  // Save what the robot was doing right before it was disabled
+  flight_recorder_flush(FLIGHT_DISABLED);
+
+  // Print how long the timed scopes took, this prints nothing unless built with TIMING_ENABLED
+  timing_report();
 }
 
 /**
@@ -137,77 +183,28 @@ void autonomous() {
   ez::as::auton_selector.selected_auton_call();  // Calls selected auton from autonomous selector
 }
 
-/**
- * Simplifies printing tracker values to the brain screen
- */
-void screen_print_tracker(ez::tracking_wheel* tracker, std::string name, int line) {
-  std::string tracker_value = "", tracker_width = "";
-  // Check if the tracker exists
-  if (tracker != nullptr) {
-    tracker_value = name + " tracker: " + util::to_string_with_precision(tracker->get());             // Make text for the tracker value
-    tracker_width = "  width: " + util::to_string_with_precision(tracker->distance_to_center_get());  // Make text for the distance to center
-  }
-  ez::screen_print(tracker_value + tracker_width, line);  // Print final tracker text
-}
-
-/**
- * Ez screen task
- * Adding new pages here will let you view them during user control or autonomous
- * and will help you debug problems you're having
- */
-void ez_screen_task() {
-  while (true) {
-    // Only run this when not connected to a competition switch
-    if (!pros::competition::is_connected()) {
-      // Blank page for odom debugging
-      if (chassis.odom_enabled() && !chassis.pid_tuner_enabled()) {
-        // If we're on the first blank page...
-        if (ez::as::page_blank_is_on(0)) {
-          // Display X, Y, and Theta
-          ez::screen_print("x: " + util::to_string_with_precision(chassis.odom_x_get()) +
-                               "\ny: " + util::to_string_with_precision(chassis.odom_y_get()) +
-                               "\na: " + util::to_string_with_precision(chassis.odom_theta_get()),
-                           1);  // Don't override the top Page line
-
-          // Display all trackers that are being used
-          screen_print_tracker(chassis.odom_tracker_left, "l", 4);
-          screen_print_tracker(chassis.odom_tracker_right, "r", 5);
-          screen_print_tracker(chassis.odom_tracker_back, "b", 6);
-          screen_print_tracker(chassis.odom_tracker_front, "f", 7);
-        }
-      }
-    }
-
-    // Remove all blank pages when connected to a comp switch
-    else {
-      if (ez::as::page_blank_amount() > 0)
-        ez::as::page_blank_remove_all();
-    }
-
-    pros::delay(ez::util::DELAY_TIME);
-  }
-}
-pros::Task ezScreenTask(ez_screen_task);
-
 /**
  * Gives you some extras to run in your opcontrol:
  * - run your autonomous routine in opcontrol by pressing DOWN and B
  *   - to prevent this from accidentally happening at a competition, this
  *     is only enabled when you're not connected to competition control.
  * - gives you a GUI to change your PID values live by pressing X
+ * - records driver control to the SD card by holding B and pressing UP
  */
 void ez_template_extras() {
   // Only run this when not connected to a competition switch
   if (!pros::competition::is_connected()) {
     // PID Tuner
-    // - after you find values that you're happy with, you'll have to set them in auton.cpp
+    // - after you find values that you're happy with, turn it off to save them to the SD card
 
     // Enable / Disable PID Tuner
     //  When enabled:
     //  * use A and Y to increment / decrement the constants
     //  * use the arrow keys to navigate the constants
-    if (master.get_digital_new_press(DIGITAL_X))
-      chassis.pid_tuner_toggle();
+    //  When disabled, the tuned constants are saved to the SD card
+    if (master.get_digital_new_press(DIGITAL_X)) {
+      config_tuner_toggle();
+    }
 
     // Trigger the selected autonomous routine
     if (master.get_digital(DIGITAL_B) && master.get_digital(DIGITAL_DOWN)) {
@@ -216,17 +213,43 @@ void ez_template_extras() {
       chassis.drive_brake_set(preference);
     }
 
+    // Start / stop recording driver control to the SD card
+    if (master.get_digital(DIGITAL_B) && master.get_digital_new_press(DIGITAL_UP)) {
+      if (recording_active())
+        recording_stop();
+      else
+        recording_start();
+    }
+
     // Allow PID Tuner to iterate
     chassis.pid_tuner_iterate();
   }
 
-  // Disable PID Tuner when connected to a comp switch
+  // Disable PID Tuner and recording when connected to a comp switch
   else {
     if (chassis.pid_tuner_enabled())
       chassis.pid_tuner_disable();
+    recording_stop();
   }
 }
 
+/**
+ * One tick of driver control.  Everything here must read the controller through
+ * input_analog() / input_digital() so recordings replay through the same code.
+ */
+void opcontrol_iterate() {
+  TIME_SCOPE("opcontrol_iterate");
+  // drive_opcontrol_tank();  // Tank control
+  drive_opcontrol_arcade(ez::SPLIT);  // Standard split arcade
+  // drive_opcontrol_arcade(ez::SINGLE);  // Standard single arcade
+
+  subsystem_opcontrol();
+
+  // . . .
+  // Put more user control code here!
+  // . . .
+}
+
 /**
  * Runs the operator control code. This function will be started in its own task
  * with the default priority and stack size whenever the robot is enabled via
@@ -240,23 +263,26 @@ void ez_template_extras() {
  * operator control task will be stopped. Re-enabling the robot will restart the
  * task, not resume it from where it left off.
  */
+static TaskProfile opcontrol_profile("opcontrol");
+
 void opcontrol() {
   // This is preference to what you like to drive on
   chassis.drive_brake_set(MOTOR_BRAKE_COAST);
 
+  curve_boot.join();  // The curve is still loading if opcontrol started right after initialize()
+
+  opcontrol_profile.start();
   while (true) {
+    opcontrol_profile.begin();
+
     // Gives you some extras to make EZ-Template ezier
     ez_template_extras();
 
-    // chassis.opcontrol_tank();  // Tank control
-    chassis.opcontrol_arcade_standard(ez::SPLIT);  // Standard split arcade
-    // chassis.opcontrol_arcade_standard(ez::SINGLE);  // Standard single arcade
-    // chassis.opcontrol_arcade_flipped(ez::SPLIT);    // Flipped split arcade
-    // chassis.opcontrol_arcade_flipped(ez::SINGLE);   // Flipped single arcade
-
-    // . . .
-    // Put more user control code here!
-    // . . .
+    // Read the controller, record it if recording is on, then run driver control from it
+    input_update(controller_read());
+    recording_iterate(input_get());
+    opcontrol_iterate();
+    opcontrol_profile.end();
 
     pros::delay(ez::util::DELAY_TIME);  // This is used for timer calculations!  Keep this ez::util::DELAY_TIME
   }
@@ -0,0 +1,39 @@
+#include "main.h"
+
+// Returns 0 when the joystick is within the threshold
+static int joystick_clip(int input) {
+  return abs(input) < chassis.opcontrol_joystick_threshold_get() ? 0 : input;
+}
+
+// Takes the drive back from autonomous PID and handles everything common to every layout
+static void drive_opcontrol_prepare() {
+  if (chassis.drive_mode_get() != ez::DISABLE) chassis.drive_mode_set(ez::DISABLE);
+  joystick_curve_buttons_iterate();
+}
+
+static void drive_opcontrol_set(double left, double right) {
+  double max = chassis.opcontrol_speed_max_get();
+  if (chassis.opcontrol_drive_reverse_get()) {
+    double temp = left;
+    left = -right;
+    right = -temp;
+  }
+  drive_output_set(ez::util::clamp(left, max), ez::util::clamp(right, max));
+}
+
+void drive_opcontrol_tank() {
+  drive_opcontrol_prepare();
+
+  double l_stick = left_curve.get(joystick_clip(input_analog(ANALOG_LEFT_Y)));
+  double r_stick = left_curve.get(joystick_clip(input_analog(ANALOG_RIGHT_Y)));
+  drive_opcontrol_set(l_stick, r_stick);
+}
+
+void drive_opcontrol_arcade(ez::e_type stick_type) {
+  drive_opcontrol_prepare();
+
+  int turn_stick = stick_type == ez::SPLIT ? input_analog(ANALOG_RIGHT_X) : input_analog(ANALOG_LEFT_X);
+  double fwd = left_curve.get(joystick_clip(input_analog(ANALOG_LEFT_Y)));
+  double turn = right_curve.get(joystick_clip(turn_stick));
+  drive_opcontrol_set(fwd + turn, fwd - turn);
+}
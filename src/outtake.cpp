@@ -1,5 +1,71 @@
-#include "outtake.hpp"
+#include "main.h"
 
-void score();
+// kV is 127 power over the 200 rpm free speed
+static VelocityController outtake_velocity(0.635, 4.0, ez::PID(0.4, 0.01, 0.0, 60.0, "Outtake"));
+static OuttakeProfile outtake_profile;
 
-void score_slow();
\ No newline at end of file
+static pros::Mutex approach_mutex;
+static bool approaching = false;
+static bool spinning_up = false;
+static double approach_rpm = 0.0;
+static double approach_x = 0.0, approach_y = 0.0;
+static double last_distance = 0.0;
+static double closing_speed = 0.0;
+
+void set_outtake(int input) {
+  outtake_velocity.reset();
+  outtake.move(input);
+}
+
+void set_outtake_velocity(double rpm) {
+  outtake.move(outtake_velocity.iterate(rpm, outtake.velocity_get()));
+}
+
+static double approach_distance() {
+  return std::hypot(approach_x - chassis.odom_x_get(), approach_y - chassis.odom_y_get());
+}
+
+void outtake_approach(goal_type goal, double x, double y) {
+  approach_mutex.take();
+  approach_rpm = goal == LONG_GOAL ? outtake_long_goal_rpm : outtake_middle_goal_rpm;
+  approach_x = x;
+  approach_y = y;
+  last_distance = approach_distance();
+  closing_speed = 0.0;
+  spinning_up = false;
+  approaching = true;
+  approach_mutex.give();
+}
+
+void outtake_approach_cancel() {
+  approach_mutex.take();
+  approaching = false;
+  spinning_up = false;
+  approach_mutex.give();
+}
+
+bool outtake_approach_iterate() {
+  if (!approach_mutex.take(0)) return spinning_up;
+
+  if (approaching && !spinning_up) {
+    // Smooth the closing speed, odom jitters a little every tick
+    double distance = approach_distance();
+    double speed = (last_distance - distance) / (ez::util::DELAY_TIME / 1000.0);
+    closing_speed += 0.3 * (speed - closing_speed);
+    last_distance = distance;
+    spinning_up = outtake_profile.should_start(approach_rpm, outtake.velocity_get(), distance, closing_speed);
+  }
+  if (spinning_up) set_outtake_velocity(approach_rpm);
+
+  bool running = spinning_up;
+  approach_mutex.give();
+  return running;
+}
+
+void score() {
+  set_current_state(SCORE, 127);
+}
+
+void score_slow() {
+  set_current_state(SCORE_SLOWLY, 127);
+}
@@ -0,0 +1,16 @@
+#include "outtake_profile.hpp"
+
+#include <cmath>
+
+OuttakeProfile::OuttakeProfile() {}
+OuttakeProfile::OuttakeProfile(Constants constants) : constants(constants) {}
+
+double OuttakeProfile::spin_up_time(double target, double current) const {
+  return std::fabs(target - current) / constants.acceleration;
+}
+
+bool OuttakeProfile::should_start(double target, double current, double distance, double closing_speed) const {
+  if (distance <= constants.arrive_distance) return true;
+  if (closing_speed < constants.min_closing_speed) return false;
+  return distance / closing_speed <= spin_up_time(target, current) + constants.margin;
+}
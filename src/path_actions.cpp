@@ -0,0 +1,92 @@
+#include "main.h"
+
+static pros::Mutex path_mutex;
+static PathProgress path_progress;
+static std::vector<path_action> pending;  // Sorted by distance
+static int next_action = 0;
+static int path_version = 0;
+
+path_action at_index(int index, std::function<void()> action, double offset) {
+  return {index, offset, action};
+}
+
+path_action at_distance(double distance, std::function<void()> action) {
+  return {-1, distance, action};
+}
+
+void path_actions_set(std::vector<ez::united_odom> path, std::vector<path_action> actions) {
+  // The path starts where the robot is now, so waypoint i is point i + 1
+  std::vector<path_point> points = {{chassis.odom_x_get(), chassis.odom_y_get()}};
+  for (const auto& movement : ez::util::united_odoms_to_odoms(path)) {
+    points.push_back({movement.target.x, movement.target.y});
+  }
+
+  PathProgress progress;
+  progress.set(points);
+  for (auto& action : actions) {
+    if (action.index != -1) {
+      action.distance += progress.point_distance(action.index + 1);
+      action.index = -1;
+    }
+  }
+  std::stable_sort(actions.begin(), actions.end(), [](const path_action& a, const path_action& b) { return a.distance < b.distance; });
+
+  path_mutex.take();
+  path_progress = progress;
+  pending = actions;
+  next_action = 0;
+  path_version++;
+  path_mutex.give();
+}
+
+void pid_odom_actions_set(std::vector<ez::united_odom> path, std::vector<path_action> actions, bool slew_on) {
+  // Start the motion first so the subsystem task doesn't see the drive disabled and drop the actions
+  chassis.pid_odom_set(path, slew_on);
+  path_actions_set(path, actions);
+}
+
+int path_points_get(path_point* points, int max) {
+  path_mutex.take();
+  const auto& path = path_progress.points_get();
+  int count = std::min((int)path.size(), max);
+  std::copy(path.begin(), path.begin() + count, points);
+  path_mutex.give();
+  return count;
+}
+
+int path_version_get() { return path_version; }
+
+path_point path_lookahead_get() {
+  path_mutex.take();
+  path_point point = path_progress.point_at(path_progress.progress_get() + chassis.odom_look_ahead_get());
+  path_mutex.give();
+  return point;
+}
+
+void path_actions_clear() {
+  path_mutex.take();
+  pending.clear();
+  next_action = 0;
+  path_mutex.give();
+}
+
+void path_actions_iterate() {
+  TIME_SCOPE("path_actions_iterate");
+  if (!path_mutex.take(0)) return;  // The auton is setting a new path, catch up next tick
+
+  if (next_action < (int)pending.size()) {
+    // Driver control or another motion took over
+    if (chassis.drive_mode_get() == ez::DISABLE) {
+      pending.clear();
+      next_action = 0;
+    } else {
+      double progress = path_progress.update(chassis.odom_x_get(), chassis.odom_y_get());
+      while (next_action < (int)pending.size() && progress >= pending[next_action].distance) {
+        pending[next_action].action();
+        next_action++;
+      }
+    }
+  }
+
+  path_mutex.give();
+}
@@ -0,0 +1,52 @@
+#include "path_generator.hpp"
+
+#include <cmath>
+
+void path_inject(const std::vector<path_point>& waypoints, double spacing, std::vector<generated_point>& path) {
+  path.clear();
+  if (waypoints.size() < 2) return;
+
+  for (int i = 1; i < (int)waypoints.size(); i++) {
+    path_point from = waypoints[i - 1];
+    path_point to = waypoints[i];
+    double length = std::hypot(to.x - from.x, to.y - from.y);
+    int steps = spacing > 0 ? (int)(length / spacing) : 0;
+
+    // Evenly spaced points after the start of the segment, the end is added below
+    for (int step = 1; step < steps; step++) {
+      double t = step * spacing / length;
+      path.push_back({{from.x + (to.x - from.x) * t, from.y + (to.y - from.y) * t}, i});
+    }
+    path.push_back({to, i});
+  }
+}
+
+int path_smooth(path_point start, std::vector<generated_point>& path, double weight_smooth, double weight_data,
+                double tolerance, int max_passes) {
+  int count = path.size();
+  if (count < 2) return 0;
+
+  // Where every point was generated, the start is index 0 here and path[i] is index i + 1
+  std::vector<path_point> original(count + 1);
+  original[0] = start;
+  for (int i = 0; i < count; i++) original[i + 1] = path[i].point;
+  std::vector<path_point> smoothed = original;
+
+  int passes = 0;
+  double change = tolerance;
+  while (change >= tolerance && passes < max_passes) {
+    change = 0.0;
+    for (int i = 1; i < count; i++) {
+      path_point before = smoothed[i];
+      smoothed[i].x += weight_data * (original[i].x - smoothed[i].x) +
+                       weight_smooth * (smoothed[i - 1].x + smoothed[i + 1].x - 2.0 * smoothed[i].x);
+      smoothed[i].y += weight_data * (original[i].y - smoothed[i].y) +
+                       weight_smooth * (smoothed[i - 1].y + smoothed[i + 1].y - 2.0 * smoothed[i].y);
+      change += std::fabs(smoothed[i].x - before.x) + std::fabs(smoothed[i].y - before.y);
+    }
+    passes++;
+  }
+
+  for (int i = 0; i < count; i++) path[i].point = smoothed[i + 1];
+  return passes;
+}
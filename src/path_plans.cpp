@@ -0,0 +1,115 @@
+#include "main.h"
+
+// Held while generating and while a motion copies a generated path
+static pros::Mutex plans_mutex;
+static int plans_time = 0;
+static int plans_page = -1;  // Selector page the paths were generated for, -1 before the first time
+
+// Function local so it exists before any plan registers itself, no matter the initialization order
+static std::vector<PathPlan*>& plans() {
+  static std::vector<PathPlan*> registered;
+  return registered;
+}
+
+void PathPlan::plan_register() { plans().push_back(this); }
+
+void PathPlan::generate() {
+  generated = false;
+
+  std::vector<ez::odom> targets = ez::util::united_odoms_to_odoms(path);
+  for (const auto& target : targets) {
+    if (target.target.theta != ez::ANGLE_NOT_SET) return;  // Boomerang points get reworked when the motion starts
+  }
+
+  ez::pose from = ez::util::united_pose_to_pose(start);
+  std::vector<path_point> waypoints = {{from.x, from.y}};
+  for (const auto& target : targets) waypoints.push_back({target.target.x, target.target.y});
+
+  std::vector<double> smoothing = chassis.odom_path_smooth_constants_get();
+  path_inject(waypoints, chassis.odom_path_spacing_get(), points);
+  path_smooth(waypoints[0], points, smoothing[0], smoothing[1], smoothing[2]);
+
+  // Every point drives like the waypoint it's heading to
+  movements.clear();
+  movements.reserve(points.size());
+  for (const auto& point : points) {
+    ez::odom movement = targets[point.waypoint - 1];
+    movement.target.x = point.point.x;
+    movement.target.y = point.point.y;
+    movements.push_back(movement);
+  }
+  generated = true;
+}
+
+void PathPlan::release() {
+  generated = false;
+  std::vector<ez::odom>().swap(movements);
+  std::vector<generated_point>().swap(points);
+}
+
+// True when the robot is close enough to where the plan starts that its path is still right
+static bool near_start(const PathPlan& plan) {
+  ez::pose start = ez::util::united_pose_to_pose(plan.start);
+  ez::pose robot = chassis.odom_pose_get();
+  return std::hypot(robot.x - start.x, robot.y - start.y) <= path_plan_start_tolerance;
+}
+
+void pid_odom_actions_set(PathPlan& plan, std::vector<path_action> actions, bool slew_on) {
+  // Don't wait if the paths are being generated again, EZ-Template can do it like it normally would.
+  // ready() is only checked under the lock, the plan task can clear it while regenerating.  A robot
+  // that ended the last motion somewhere else would chase back to the plan's start first
+  bool used = false;
+  if (!near_start(plan)) {
+    printf("Robot is off the start of a path plan, injecting it from here\n");
+  } else if (plans_mutex.take(0)) {
+    if (plan.ready()) {
+      chassis.pid_odom_pp_set(plan.movements_get(), slew_on);
+      used = true;
+    }
+    plans_mutex.give();
+  }
+  if (!used) chassis.pid_odom_set(plan.path, slew_on);
+  path_actions_set(plan.path, actions);
+}
+
+// The selected auton, or nullptr if it isn't a plain function
+static const void* route_selected() {
+  auto& selector = ez::as::auton_selector;
+  int page = selector.auton_page_current;
+  if (page < 0 || page >= (int)selector.Autons.size()) return nullptr;
+  auto route = selector.Autons[page].auton_call.target<void (*)()>();
+  return route == nullptr ? nullptr : (const void*)*route;
+}
+
+void path_plans_generate() {
+  const void* route = route_selected();
+  uint32_t start = pros::micros();
+
+  plans_mutex.take();
+  int generated = 0;
+  for (auto plan : plans()) {
+    if (route == nullptr || plan->route == route) {
+      plan->generate();
+      generated++;
+    } else {
+      plan->release();
+    }
+  }
+  plans_page = ez::as::auton_selector.auton_page_current;
+  plans_mutex.give();
+
+  plans_time = pros::micros() - start;
+  printf("Generated %i paths in %.1f ms\n", generated, plans_time / 1000.0);
+}
+
+int path_plans_time_get() { return plans_time; }
+
+void path_plans_task() {
+  while (true) {
+    // Wait for the first path_plans_generate() in initialize(), before that the selector may not be loaded
+    bool changed = plans_page != -1 && ez::as::auton_selector.auton_page_current != plans_page;
+    if (changed && pros::competition::is_disabled()) path_plans_generate();
+    pros::delay(100);
+  }
+}
+pros::Task pathPlansTask(path_plans_task, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_DEFAULT, "path plans");
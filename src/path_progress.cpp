@@ -0,0 +1,67 @@
+#include "path_progress.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+static const int LOOK_AHEAD_SEGMENTS = 2;
+
+void PathProgress::set(std::vector<path_point> new_points) {
+  points = new_points;
+  distances.assign(points.size(), 0.0);
+  for (int i = 1; i < (int)points.size(); i++) {
+    distances[i] = distances[i - 1] + std::hypot(points[i].x - points[i - 1].x, points[i].y - points[i - 1].y);
+  }
+  segment = 0;
+  progress = 0;
+}
+
+double PathProgress::update(double x, double y) {
+  int last_segment = (int)points.size() - 2;
+  if (last_segment < 0) return progress;
+
+  double best_error = INFINITY;
+  int best_segment = segment;
+  double best_progress = progress;
+  for (int i = segment; i <= std::min(segment + LOOK_AHEAD_SEGMENTS, last_segment); i++) {
+    double dx = points[i + 1].x - points[i].x;
+    double dy = points[i + 1].y - points[i].y;
+    double length_squared = dx * dx + dy * dy;
+
+    // How far along this segment the closest point is, 0 to 1
+    double t = length_squared > 0 ? ((x - points[i].x) * dx + (y - points[i].y) * dy) / length_squared : 0;
+    t = std::clamp(t, 0.0, 1.0);
+
+    double error = std::hypot(points[i].x + t * dx - x, points[i].y + t * dy - y);
+    if (error < best_error) {
+      best_error = error;
+      best_segment = i;
+      best_progress = distances[i] + t * std::sqrt(length_squared);
+    }
+  }
+
+  segment = best_segment;
+  progress = std::max(progress, best_progress);
+  return progress;
+}
+
+double PathProgress::point_distance(int index) const {
+  if (index < 0 || index >= (int)distances.size()) return length_get();
+  return distances[index];
+}
+
+path_point PathProgress::point_at(double distance) const {
+  if (points.empty()) return {0, 0};
+  for (int i = 1; i < (int)points.size(); i++) {
+    if (distance > distances[i]) continue;
+    double length = distances[i] - distances[i - 1];
+    double t = length > 0 ? std::max(0.0, distance - distances[i - 1]) / length : 0;
+    return {points[i - 1].x + t * (points[i].x - points[i - 1].x), points[i - 1].y + t * (points[i].y - points[i - 1].y)};
+  }
+  return points.back();
+}
+
+double PathProgress::length_get() const { return distances.empty() ? 0 : distances.back(); }
+
+double PathProgress::progress_get() const { return progress; }
+
+const std::vector<path_point>& PathProgress::points_get() const { return points; }
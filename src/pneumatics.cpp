@@ -0,0 +1,45 @@
+#include "main.h"
+
+static const double ATMOSPHERE = 14.7;  // psi
+static const int MAX_ACTUATIONS = 999;
+
+TrackedPiston::TrackedPiston(int port, AirTank& tank, Cylinder cylinder, bool default_state)
+    : piston(port, default_state), cylinder(cylinder), tank(tank) {}
+
+void TrackedPiston::actuated(bool extended) {
+  double volume = extended ? cylinder.extend_volume() : cylinder.retract_volume();
+  air_used += volume * tank.pressure_get() / ATMOSPHERE;
+  tank.use(volume);
+  actuations++;
+}
+
+void TrackedPiston::set(bool input) {
+  if (input != piston.get()) actuated(input);
+  piston.set(input);
+}
+
+bool TrackedPiston::get() { return piston.get(); }
+
+void TrackedPiston::button_toggle(int toggle) {
+  bool last = piston.get();
+  piston.button_toggle(toggle);
+  if (piston.get() != last) actuated(piston.get());
+}
+
+int TrackedPiston::actuations_get() const { return actuations; }
+
+double TrackedPiston::air_used_get() const { return air_used; }
+
+int TrackedPiston::actuations_left() {
+  double pressure = tank.pressure_get();
+  bool extended = piston.get();
+  int left = 0;
+  // Walk forward alternating extend and retract until the tank is too low
+  while (left < MAX_ACTUATIONS) {
+    extended = !extended;
+    pressure = tank.pressure_after(pressure, extended ? cylinder.extend_volume() : cylinder.retract_volume());
+    if (!tank.usable(pressure)) break;
+    left++;
+  }
+  return left;
+}
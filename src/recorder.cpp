@@ -0,0 +1,83 @@
+#include "main.h"
+
+/////
+// Recording and playback
+/////
+
+static const char* RECORDING_FILE = "/usd/recording.bin";
+
+// About 6 bytes per changed tick, so this holds well over a minute of constant stick movement
+static uint8_t recording_buffer[65536];
+static RecordingEncoder encoder(recording_buffer, sizeof(recording_buffer), ez::util::DELAY_TIME);
+static bool recording_on = false;
+static uint32_t recording_start_time = 0;
+
+void recording_start() {
+  encoder = RecordingEncoder(recording_buffer, sizeof(recording_buffer), ez::util::DELAY_TIME);
+  recording_start_time = pros::millis();
+  recording_on = true;
+  controller_rumble(".");
+}
+
+void recording_stop() {
+  if (!recording_on) return;
+  recording_on = false;
+  size_t length = encoder.finish();
+
+  if (!ez::util::SD_CARD_ACTIVE) {
+    printf("Recording not saved, no SD card\n");
+    return;
+  }
+  FILE* file = fopen(RECORDING_FILE, "wb");
+  if (file == nullptr) return;
+  fwrite(recording_buffer, 1, length, file);
+  fclose(file);
+  printf("Saved %i byte recording to %s\n", (int)length, RECORDING_FILE);
+  controller_rumble("..");
+}
+
+bool recording_active() { return recording_on; }
+
+void recording_iterate(const controller_frame& frame) {
+  if (!recording_on) return;
+  uint32_t tick = (pros::millis() - recording_start_time) / ez::util::DELAY_TIME;
+  if (!encoder.add(tick, frame)) {
+    printf("Recording buffer full\n");
+    recording_stop();
+  }
+}
+
+void recording_play() {
+  FILE* file = fopen(RECORDING_FILE, "rb");
+  if (file == nullptr) {
+    printf("No recording at %s\n", RECORDING_FILE);
+    return;
+  }
+  size_t length = fread(recording_buffer, 1, sizeof(recording_buffer), file);
+  fclose(file);
+
+  RecordingDecoder decoder(recording_buffer, length);
+  if (!decoder.valid()) {
+    printf("%s is not a recording\n", RECORDING_FILE);
+    return;
+  }
+
+  // Ticks come from the clock, so a late tick applies everything it missed and playback stays in time
+  int mismatches = 0;
+  uint32_t tick = 0;
+  uint32_t start = pros::millis();
+  uint32_t now = start;
+  while (!decoder.done()) {
+    tick = (pros::millis() - start) / ez::util::DELAY_TIME;
+    const controller_frame& frame = decoder.at(tick);
+    if (frame.state != get_current_state()) mismatches++;
+    input_update(frame);
+    opcontrol_iterate();
+    pros::Task::delay_until(&now, ez::util::DELAY_TIME);
+  }
+
+  // Centered sticks and no buttons stops everything
+  input_update(controller_frame());
+  opcontrol_iterate();
+  printf("Replayed %i ticks, %i ticks where the subsystem state didn't match the recording\n", tick, mismatches);
+}
@@ -0,0 +1,99 @@
+#include "recording_format.hpp"
+
+#include <cstring>
+
+static uint32_t zigzag(int32_t n) { return ((uint32_t)n << 1) ^ (uint32_t)(n >> 31); }
+static int32_t unzigzag(uint32_t n) { return (int32_t)(n >> 1) ^ -(int32_t)(n & 1); }
+
+RecordingEncoder::RecordingEncoder(uint8_t* buffer, size_t capacity, uint8_t tick_length)
+    : buffer(buffer), capacity(capacity) {
+  const uint8_t header[RECORDING_HEADER_SIZE] = {'E', 'Z', 'R', 'C', RECORDING_VERSION, tick_length};
+  for (auto byte : header) put(byte);
+}
+
+// Always leaves room for the end marker
+bool RecordingEncoder::put(uint8_t byte) {
+  if (length + 1 >= capacity) return false;
+  buffer[length++] = byte;
+  return true;
+}
+
+bool RecordingEncoder::put_varint(uint32_t value) {
+  while (value >= 0x80) {
+    if (!put((value & 0x7F) | 0x80)) return false;
+    value >>= 7;
+  }
+  return put(value);
+}
+
+bool RecordingEncoder::add(uint32_t tick, const controller_frame& frame) {
+  uint8_t mask = 0;
+  for (int i = 0; i < 4; i++)
+    if (frame.axes[i] != last.axes[i]) mask |= 1 << i;
+  if (frame.buttons != last.buttons) mask |= 1 << 4;
+  if (frame.state != last.state) mask |= 1 << 5;
+  if (mask == 0) return true;
+
+  size_t start = length;
+  bool ok = put(mask) && put_varint(tick - last_tick);
+  for (int i = 0; i < 4 && ok; i++)
+    if (mask & (1 << i)) ok = put_varint(zigzag(frame.axes[i] - last.axes[i]));
+  if (ok && (mask & (1 << 4))) ok = put_varint(frame.buttons ^ last.buttons);
+  if (ok && (mask & (1 << 5))) ok = put(frame.state);
+
+  // Don't leave half a record behind
+  if (!ok) {
+    length = start;
+    return false;
+  }
+  last = frame;
+  last_tick = tick;
+  return true;
+}
+
+size_t RecordingEncoder::finish() {
+  buffer[length++] = RECORDING_END;
+  return length;
+}
+
+RecordingDecoder::RecordingDecoder(const uint8_t* buffer, size_t length) : buffer(buffer), length(length) {
+  has_pending = valid() && next();
+}
+
+bool RecordingDecoder::valid() const {
+  return length >= RECORDING_HEADER_SIZE && memcmp(buffer, "EZRC", 4) == 0 && buffer[4] == RECORDING_VERSION;
+}
+
+uint32_t RecordingDecoder::get_varint() {
+  uint32_t value = 0;
+  for (int shift = 0; position < length && shift < 32; shift += 7) {
+    uint8_t byte = buffer[position++];
+    value |= (uint32_t)(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) break;
+  }
+  return value;
+}
+
+// Reads the next record into pending, returns false at the end
+bool RecordingDecoder::next() {
+  if (position >= length) return false;
+  uint8_t mask = buffer[position++];
+  if (mask == RECORDING_END) return false;
+
+  next_tick += get_varint();
+  for (int i = 0; i < 4; i++)
+    if (mask & (1 << i)) pending.axes[i] += unzigzag(get_varint());
+  if (mask & (1 << 4)) pending.buttons ^= get_varint();
+  if ((mask & (1 << 5)) && position < length) pending.state = buffer[position++];
+  return true;
+}
+
+const controller_frame& RecordingDecoder::at(uint32_t tick) {
+  while (has_pending && next_tick <= tick) {
+    current = pending;
+    has_pending = next();
+  }
+  return current;
+}
+
+bool RecordingDecoder::done() const { return !has_pending; }
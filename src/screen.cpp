@@ -0,0 +1,186 @@
+#include "main.h"
+
+#include <cstdarg>
+
+void ScreenLines::print(int line, const char* format, ...) {
+  if (line < 0 || line >= LINES) return;
+  va_list args;
+  va_start(args, format);
+  vsnprintf(next[line], WIDTH, format, args);
+  va_end(args);
+}
+
+void ScreenLines::clear(int line) {
+  if (line < 0 || line >= LINES) return;
+  next[line][0] = '\0';
+}
+
+int ScreenLines::draw(int first_line) {
+  int drawn = 0;
+  for (int line = first_line; line < LINES; line++) {
+    if (valid[line] && strcmp(next[line], shown[line]) == 0) continue;
+    pros::lcd::print(line, "%s", next[line]);
+    memcpy(shown[line], next[line], WIDTH);
+    valid[line] = true;
+    drawn++;
+  }
+  return drawn;
+}
+
+void ScreenLines::invalidate() {
+  for (int line = 0; line < LINES; line++) valid[line] = false;
+}
+
+static ScreenLines screen;
+
+// Microseconds spent per refresh, averaged with an EMA
+static double screen_micros = 0.0;
+static int screen_micros_max = 0;
+
+int screen_task_micros_get() { return screen_micros; }
+
+int screen_task_micros_max_get() { return screen_micros_max; }
+
+// Microseconds spent sending lines, for draws that sent a whole page and for draws that only sent
+// what changed.  A whole page is what every refresh cost before lines were compared
+static double draw_full_micros = 0.0;
+static double draw_changed_micros = 0.0;
+static double draw_changed_lines = 0.0;
+
+/**
+ * Sends the page below the top Page line and times it
+ */
+static void screen_draw() {
+  uint32_t start = pros::micros();
+  int drawn = screen.draw(1);  // Don't override the top Page line
+  int elapsed = pros::micros() - start;
+  if (drawn == ScreenLines::LINES - 1) {
+    draw_full_micros += 0.1 * (elapsed - draw_full_micros);
+  } else {
+    draw_changed_micros += 0.1 * (elapsed - draw_changed_micros);
+    draw_changed_lines += 0.1 * (drawn - draw_changed_lines);
+  }
+}
+
+/**
+ * Simplifies printing tracker values to the brain screen
+ */
+static void screen_print_tracker(ez::tracking_wheel* tracker, const char* name, int line) {
+  // Check if the tracker exists
+  if (tracker != nullptr)
+    screen.print(line, "%s tracker: %.2f  width: %.2f", name, tracker->get(), tracker->distance_to_center_get());
+  else
+    screen.clear(line);
+}
+
+// Page 0, odom debugging
+static void odom_page() {
+  // Display X, Y, and Theta
+  screen.print(1, "x: %.2f", chassis.odom_x_get());
+  screen.print(2, "y: %.2f", chassis.odom_y_get());
+  screen.print(3, "a: %.2f  speed: %i -> %i", chassis.odom_theta_get(), gain_compensate_speed_requested_get(),
+               gain_compensate_speed_written_get());
+
+  // Display all trackers that are being used
+  screen_print_tracker(chassis.odom_tracker_left, "l", 4);
+  screen_print_tracker(chassis.odom_tracker_right, "r", 5);
+  screen_print_tracker(chassis.odom_tracker_back, "b", 6);
+  screen_print_tracker(chassis.odom_tracker_front, "f", 7);
+}
+
+// Page 1, subsystem debugging
+static void subsystem_page() {
+  screen.print(1, "air: %.1f psi", air_tank.pressure_get());
+  screen.print(2, "scraper: %i left", scraper.actuations_left());
+  screen.print(3, "balls: %i  scored: %i", balls_held_get(), balls_scored_get());
+  screen.print(4, "jams: %i  ejected: %i", conveyor_jams_get(), color_sort_ejected_get());
+  screen.print(5, "screen: %i us  max %i us", screen_task_micros_get(), screen_task_micros_max_get());
+  screen.print(6, "draw: all %i us  changed %i us (%.1f)", (int)draw_full_micros, (int)draw_changed_micros,
+               draw_changed_lines);
+  screen.print(7, "boot: %i ms  paths: %.1f ms", boot_time_get(), path_plans_time_get() / 1000.0);
+}
+
+// Page 3, CPU and stack use of our tasks
+static void task_page() {
+  if (cpu_load_get() < 0)
+    screen.print(1, "cpu off  ours %.1f%%  %i tasks", task_profiles_cpu_get(), pros::Task::get_count());
+  else
+    screen.print(1, "cpu %.1f%%  ours %.1f%%  other %.1f%%  %i tasks", cpu_load_get(), task_profiles_cpu_get(),
+                 cpu_other_get(), pros::Task::get_count());
+  int line = 2;
+  for (auto profile : task_profiles_get()) {
+    if (line >= ScreenLines::LINES) break;
+    screen.print(line++, "%-10s %5.1f%%  %5i B free", profile->name, profile->cpu_get(), profile->stack_free_get());
+  }
+  while (line < ScreenLines::LINES) screen.clear(line++);
+}
+
+/**
+ * Ez screen task
+ * Adding new pages here will let you view them during user control or autonomous
+ * and will help you debug problems you're having
+ */
+static TaskProfile screen_profile("screen");
+
+void ez_screen_task() {
+  screen_profile.start();
+  int last_page = -1;
+  uint32_t now = pros::millis();
+  while (true) {
+    screen_profile.begin();
+    uint32_t start = pros::micros();
+
+    // Only run this when not connected to a competition switch
+    if (!pros::competition::is_connected()) {
+      // Make sure the blank pages exist
+      if (chassis.odom_enabled()) ez::as::page_blank_is_on(0);
+      ez::as::page_blank_is_on(1);
+      ez::as::page_blank_is_on(2);
+      ez::as::page_blank_is_on(3);
+      int page = chassis.pid_tuner_enabled() ? -1 : ez::as::page_blank_current();
+
+      // The auton selector and the PID tuner draw over the screen, so redraw everything when coming back
+      if (page != last_page) screen.invalidate();
+      last_page = page;
+
+      // Blank page for odom debugging
+      if (page == 0 && chassis.odom_enabled()) {
+        odom_page();
+        screen_draw();
+      }
+
+      // Blank page for subsystem debugging
+      else if (page == 1) {
+        subsystem_page();
+        screen_draw();
+      }
+
+      // Blank page for task debugging
+      else if (page == 3) {
+        task_page();
+        screen_draw();
+      }
+
+      // Blank page with a map of the field
+      if (page == 2)
+        field_map_draw();
+      else
+        field_map_hide();
+    }
+
+    // Remove all blank pages when connected to a comp switch
+    else {
+      if (ez::as::page_blank_amount() > 0)
+        ez::as::page_blank_remove_all();
+      field_map_hide();
+    }
+
+    int elapsed = pros::micros() - start;
+    screen_micros += 0.1 * (elapsed - screen_micros);
+    if (elapsed > screen_micros_max) screen_micros_max = elapsed;
+    screen_profile.end();
+
+    pros::Task::delay_until(&now, screen_refresh_time);
+  }
+}
+pros::Task ezScreenTask(ez_screen_task);
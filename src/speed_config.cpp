@@ -1,10 +1,11 @@
-#include "speed_config.hpp"
+#include "main.h"
 
 state get_current_state() {
   return current_state;
 }
 
 void set_current_state(state new_state, int new_speed) {
-  current_speed = new_state;
+  current_state = new_state;
   current_speed = new_speed;
-}
\ No newline at end of file
+  subsystem_post(new_state, new_speed);
+}
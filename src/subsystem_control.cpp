@@ -0,0 +1,118 @@
+#include "main.h"
+
+#include <atomic>
+
+// Indexed by state
+static state_outputs state_table[] = {
+    {0, 0, 0, 0, 0, 0},                                          // STOP
+    {127, 127, 0, 0, 0, 0},                                      // INTAKE, hold balls below the top stage
+    {-127, -127, -127, -127, 0, 0},                              // OUTTAKE
+    {127, 0, 0, 0, conveyor_fast_bps, outtake_long_goal_rpm},    // SCORE, long goals
+    {127, 0, 0, 0, conveyor_slow_bps, outtake_middle_goal_rpm},  // SCORE_SLOWLY, middle goals
+};
+
+// One slot holding the newest request as (state << 8) | speed
+static const uint32_t MAILBOX_EMPTY = 0xFFFFFFFF;
+static std::atomic<uint32_t> mailbox{MAILBOX_EMPTY};
+
+static state applied_state = STOP;
+static int applied_speed = 0;
+static uint32_t state_start_time = 0;
+static int loop_time = 0;
+
+void subsystem_post(state new_state, int speed) {
+  speed = ez::util::clamp(speed, 127, 0);
+  mailbox.store(((uint32_t)new_state << 8) | (uint32_t)speed);
+}
+
+state subsystem_state_get() { return applied_state; }
+
+int subsystem_state_time_get() { return pros::millis() - state_start_time; }
+
+int subsystem_loop_time_get() { return loop_time; }
+
+void subsystem_opcontrol() {
+  state requested = STOP;
+  if (input_digital(DIGITAL_R1))
+    requested = SCORE;
+  else if (input_digital(DIGITAL_R2))
+    requested = SCORE_SLOWLY;
+  else if (input_digital(DIGITAL_L1))
+    requested = INTAKE;
+  else if (input_digital(DIGITAL_L2))
+    requested = OUTTAKE;
+
+  if (requested != get_current_state()) set_current_state(requested, 127);
+}
+
+// Scales a table output by the requested speed
+static int scaled(int output) { return output * applied_speed / 127; }
+
+void subsystem_speeds_update() {
+  state_table[SCORE].conveyor_bps = conveyor_fast_bps;
+  state_table[SCORE].outtake_rpm = outtake_long_goal_rpm;
+  state_table[SCORE_SLOWLY].conveyor_bps = conveyor_slow_bps;
+  state_table[SCORE_SLOWLY].outtake_rpm = outtake_middle_goal_rpm;
+}
+
+void subsystem_iterate() {
+  TIME_SCOPE("subsystem_iterate");
+  uint32_t request = mailbox.exchange(MAILBOX_EMPTY);
+  if (request != MAILBOX_EMPTY) {
+    state new_state = (state)(request >> 8);
+    int new_speed = request & 0xFF;
+    if (new_state != applied_state) {
+      state_start_time = pros::millis();
+      // Balls the sorter is tracking won't reach the eject point once the conveyor stops or reverses
+      if (new_state == OUTTAKE || new_state == STOP) color_sort_reset();
+      // Anything but scoring means the robot isn't going to score at the goal it was spinning up for
+      if (new_state != SCORE && new_state != SCORE_SLOWLY) outtake_approach_cancel();
+    }
+    applied_state = new_state;
+    applied_speed = new_speed;
+  }
+
+  subsystem_motors_update();
+  path_actions_iterate();
+
+  bool ejecting = color_sort_iterate();
+  ball_tracking_iterate(ejecting);
+
+  const state_outputs& outputs = state_table[applied_state];
+  // Stop pulling balls in once there's no room for them
+  bool hold = applied_state == INTAKE && balls_full();
+  set_intake_speed(hold ? 0 : scaled(outputs.intake));
+  if (outputs.conveyor_bps != 0) {
+    set_conveyor_throughput(outputs.conveyor_bps * applied_speed / 127.0);
+  } else {
+    set_bottom_conveyor(hold ? 0 : scaled(outputs.bottom_conveyor));
+    set_top_conveyor(scaled(outputs.top_conveyor));
+  }
+  // Sorting overrides the outtake while a wrong colored ball goes past, and scoring takes over
+  // from spinning up on the way to the goal.  A state that runs the outtake itself always wins
+  // over spinning up
+  if (ejecting) {
+    set_outtake(color_sort_eject_power);
+  } else if (outputs.outtake_rpm != 0) {
+    outtake_approach_cancel();
+    set_outtake_velocity(outputs.outtake_rpm * applied_speed / 127.0);
+  } else if (outputs.outtake != 0 || !outtake_approach_iterate()) {
+    set_outtake(scaled(outputs.outtake));
+  }
+}
+
+static TaskProfile subsystem_profile("subsystems");
+
+void subsystem_task() {
+  subsystem_profile.start();
+  uint32_t now = pros::millis();
+  while (true) {
+    subsystem_profile.begin();
+    uint32_t start = pros::micros();
+    subsystem_iterate();
+    loop_time = pros::micros() - start;
+    subsystem_profile.end();
+    pros::Task::delay_until(&now, ez::util::DELAY_TIME);
+  }
+}
+pros::Task subsystemTask(subsystem_task, TASK_PRIORITY_MAX - 2, TASK_STACK_DEPTH_DEFAULT, "subsystems");
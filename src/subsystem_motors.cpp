@@ -0,0 +1,78 @@
+#include "main.h"
+
+// Function local so it exists before any group registers itself, no matter the initialization order
+static std::vector<SubsystemMotors*>& groups() {
+  static std::vector<SubsystemMotors*> registered;
+  return registered;
+}
+
+SubsystemMotors::SubsystemMotors(std::initializer_list<std::int8_t> ports, const char* name) : name(name), motors(ports) {
+  groups().push_back(this);
+}
+
+void SubsystemMotors::move(double input) {
+  if (!enabled) return;
+  motors.move_voltage(voltage_compensate(input));
+}
+
+void SubsystemMotors::update() {
+  int size = motors.size();
+  double velocity_sum = 0.0, current_sum = 0.0, position_sum = 0.0;
+  for (int i = 0; i < size; i++) {
+    velocity_sum += motors.get_actual_velocity(i);
+    current_sum += motors.get_current_draw(i);
+    position_sum += motors.get_position(i);
+  }
+  velocity = size > 0 ? velocity_sum / size : 0.0;
+  current = current_sum;
+  position = size > 0 ? position_sum / size : 0.0;
+}
+
+double SubsystemMotors::velocity_get() const { return velocity; }
+
+double SubsystemMotors::current_get() const { return current; }
+
+double SubsystemMotors::position_get() const { return position; }
+
+bool SubsystemMotors::enabled_get() const { return enabled; }
+
+void subsystem_motors_update() {
+  TIME_SCOPE("subsystem_motors_update");
+  for (auto group : groups()) {
+    group->update();
+  }
+}
+
+int subsystem_ports_validate() {
+  // Owner of every smart port, 1 to 21
+  const char* owners[22] = {};
+  int clashes = 0;
+  // Returns false when the port already has an owner
+  auto claim = [&](int port, const char* owner) {
+    port = abs(port);
+    if (port < 1 || port > 21) return true;
+    if (owners[port] != nullptr) {
+      printf("Port %i is used by both %s and %s\n", port, owners[port], owner);
+      controller_print(0, PRIORITY_HIGH, "P%i CLASH %.8s", port, owner);  // Fits 19 characters
+      clashes++;
+      return false;
+    }
+    owners[port] = owner;
+    return true;
+  };
+
+  for (auto& motor : chassis.left_motors) claim(motor.get_port(), "chassis left");
+  for (auto& motor : chassis.right_motors) claim(motor.get_port(), "chassis right");
+  claim(chassis.imu.get_port(), "IMU");
+  // Sensors go before the groups so a group that lands on a sensor's port is the one turned off
+  claim(color_sensor.get_port(), "color sensor");
+  claim(intake_entry_sensor.get_port(), "intake entry sensor");
+  for (auto group : groups()) {
+    bool clear = true;
+    for (int i = 0; i < group->motors.size(); i++) clear &= claim(group->motors.get_port(i), group->name);
+    group->enabled = clear;
+    if (!clear) printf("%s is disabled until its ports are fixed\n", group->name);
+  }
+
+  return clashes;
+}
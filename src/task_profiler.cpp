@@ -0,0 +1,129 @@
+#include "main.h"
+
+#include <atomic>
+
+static const uint32_t STACK_PATTERN = 0xA5A5A5A5;
+static const int STACK_MARGIN = 1024;  // bytes between where painting stops and anything the task has used so far
+
+// Function local so it exists before any profile registers itself, no matter the initialization order
+static std::vector<TaskProfile*>& profiles() {
+  static std::vector<TaskProfile*> registered;
+  return registered;
+}
+
+TaskProfile::TaskProfile(const char* name, int stack_depth) : name(name), stack_depth(stack_depth) {
+  profiles().push_back(this);
+}
+
+// Lowest address of the running task's stack.  PROS keeps FreeRTOS's task control block, where
+// the pointer to it sits right before the task's name
+static uintptr_t stack_base_get() {
+  const char* name = pros::c::task_get_name(pros::c::task_get_current());
+  return *(const uintptr_t*)(name - sizeof(uintptr_t));
+}
+
+// Kept out of line so its own frame is the lowest one on the stack while painting
+__attribute__((noinline)) void TaskProfile::start() {
+  slot_start = pros::micros();
+
+  // Paints from just below here down to where the stack would end if less than STACK_MARGIN were
+  // in use above here.  Anything deeper and that end is past the real bottom of the stack
+  volatile uint32_t here = 0;
+  uintptr_t top = (uintptr_t)&here - 256;
+  int words = (stack_depth * 4 - STACK_MARGIN - 256) / 4;
+  uintptr_t bottom = top - words * 4;
+  uintptr_t base = stack_base_get();
+  int used = (int)(base + stack_depth * 4 - (uintptr_t)&here);
+  if (base > (uintptr_t)&here || used > stack_depth * 4) {
+    printf("%s: couldn't find the stack, not measuring it\n", name);
+    return;
+  }
+  if (bottom < base) {
+    printf("%s: %i B of stack used before start(), more than the %i B margin, not measuring it\n", name, used, STACK_MARGIN);
+    return;
+  }
+
+  stack_bottom = (volatile uint32_t*)bottom;
+  for (int i = 0; i < words; i++) stack_bottom[i] = STACK_PATTERN;
+  stack_words = words;
+}
+
+void TaskProfile::begin() { loop_start = pros::micros(); }
+
+void TaskProfile::end() {
+  uint32_t now = pros::micros();
+  busy[slot] += now - loop_start;
+  if (now - slot_start >= SLOT_TIME * 1000) {
+    elapsed[slot] = now - slot_start;
+    slot = (slot + 1) % SLOTS;
+    busy[slot] = 0;
+    slot_start = now;
+  }
+}
+
+double TaskProfile::cpu_get() const {
+  uint64_t total_busy = 0, total_elapsed = 0;
+  for (int i = 0; i < SLOTS; i++) {
+    if (i == slot) continue;  // Still filling
+    total_busy += busy[i];
+    total_elapsed += elapsed[i];
+  }
+  return total_elapsed > 0 ? 100.0 * total_busy / total_elapsed : 0.0;
+}
+
+int TaskProfile::stack_free_get() const {
+  if (stack_bottom == nullptr) return -1;
+  int untouched = 0;
+  while (untouched < stack_words && stack_bottom[untouched] == STACK_PATTERN) untouched++;
+  return untouched * 4;
+}
+
+const std::vector<TaskProfile*>& task_profiles_get() { return profiles(); }
+
+double task_profiles_cpu_get() {
+  double total = 0.0;
+  for (auto profile : profiles()) total += profile->cpu_get();
+  return total;
+}
+
+int task_profiles_stack_free_get() {
+  int least = -1;
+  for (auto profile : profiles()) {
+    int stack_free = profile->stack_free_get();
+    if (stack_free >= 0 && (least < 0 || stack_free < least)) least = stack_free;
+  }
+  return least;
+}
+
+// A gap longer than this between two clock reads in the idle loop means another task had the core
+static const uint32_t IDLE_GAP = 10;  // us
+static const uint32_t IDLE_WINDOW = TaskProfile::SLOTS * TaskProfile::SLOT_TIME * 1000;  // us
+static std::atomic<int> cpu_load{-10};  // tenths of a percent, negative until measured
+
+double cpu_load_get() { return cpu_load.load() / 10.0; }
+
+double cpu_other_get() { return cpu_load.load() < 0 ? 0.0 : cpu_load_get() - task_profiles_cpu_get(); }
+
+void cpu_idle_task() {
+  while (true) {
+    uint32_t window_start = pros::micros();
+    uint32_t last = window_start;
+    uint32_t idle = 0;
+    uint32_t now = window_start;
+    while (now - window_start < IDLE_WINDOW) {
+      now = pros::micros();
+      if (now - last < IDLE_GAP) idle += now - last;
+      last = now;
+    }
+    cpu_load.store(1000 - (int)(1000ull * idle / (now - window_start)));
+
+    // Give FreeRTOS's idle task, which is below this one, a moment to free deleted tasks.  This ms
+    // isn't in any window
+    pros::delay(1);
+  }
+}
+void cpu_load_start() {
+  static pros::Task* idle_task = nullptr;
+  if (idle_task != nullptr) return;
+  idle_task = new pros::Task(cpu_idle_task, TASK_PRIORITY_MIN, TASK_STACK_DEPTH_MIN, "cpu idle");
+}
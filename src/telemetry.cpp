@@ -0,0 +1,70 @@
+#include "main.h"
+
+#include "pros/apix.h"
+
+static bool streaming = false;
+
+void telemetry_start() {
+  if (streaming) return;
+  chassis.pid_print_toggle(false);
+  pros::c::serctl(SERCTL_DISABLE_COBS, nullptr);
+  streaming = true;
+}
+
+void telemetry_stop() {
+  if (!streaming) return;
+  streaming = false;
+  pros::c::serctl(SERCTL_ENABLE_COBS, nullptr);
+}
+
+bool telemetry_enabled() { return streaming; }
+
+static void telemetry_fill(telemetry_packet& packet) {
+  TIME_SCOPE("telemetry_fill");
+  packet.version = TELEMETRY_VERSION;
+  packet.sequence++;
+  packet.time = pros::millis();
+
+  packet.x = chassis.odom_x_get();
+  packet.y = chassis.odom_y_get();
+  packet.theta = chassis.odom_theta_get();
+
+  packet.left_velocity = chassis.drive_velocity_left();
+  packet.right_velocity = chassis.drive_velocity_right();
+  packet.drive_target = chassis.leftPID.target_get();
+  packet.drive_error = chassis.leftPID.error;
+  packet.drive_output = chassis.leftPID.output;
+  packet.turn_target = chassis.turnPID.target_get();
+  packet.turn_error = chassis.turnPID.error;
+  packet.turn_output = chassis.turnPID.output;
+
+  packet.subsystem_state = subsystem_state_get();
+  packet.subsystem_speed = current_speed;
+  packet.balls_held = balls_held_get();
+  packet.loop_time = std::min(subsystem_loop_time_get(), 0xFFFF);
+  packet.task_cpu = std::clamp(task_profiles_cpu_get(), 0.0, 255.0);
+  packet.cpu_load = cpu_load_get() < 0 ? 0xFF : std::clamp(cpu_load_get(), 0.0, 100.0);
+  packet.cpu_other = std::clamp(cpu_other_get(), -128.0, 127.0);
+  packet.stack_free_min = std::clamp(task_profiles_stack_free_get(), 0, 0xFFFF);
+}
+
+static TaskProfile telemetry_profile("telemetry");
+
+void telemetry_task() {
+  static telemetry_packet packet = {};
+  static uint8_t frame[TELEMETRY_FRAME_MAX];
+  telemetry_profile.start();
+  uint32_t now = pros::millis();
+  while (true) {
+    telemetry_profile.begin();
+    if (streaming) {
+      telemetry_fill(packet);
+      size_t length = telemetry_frame(packet, frame);
+      fwrite(frame, 1, length, stdout);
+      fflush(stdout);
+    }
+    telemetry_profile.end();
+    pros::Task::delay_until(&now, telemetry_period);
+  }
+}
+pros::Task telemetryTask(telemetry_task, TASK_PRIORITY_DEFAULT - 1, TASK_STACK_DEPTH_DEFAULT, "telemetry");
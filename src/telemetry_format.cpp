@@ -0,0 +1,75 @@
+#include "telemetry_format.hpp"
+
+#include <cstring>
+
+uint16_t telemetry_crc(const uint8_t* data, size_t length) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i] << 8;
+    for (int bit = 0; bit < 8; bit++) crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+size_t cobs_encode(const uint8_t* input, size_t length, uint8_t* output) {
+  size_t code_index = 0;  // Where the current block's length byte goes
+  size_t out = 1;
+  uint8_t code = 1;
+  for (size_t i = 0; i < length; i++) {
+    if (input[i] == 0) {
+      output[code_index] = code;
+      code_index = out++;
+      code = 1;
+      continue;
+    }
+    output[out++] = input[i];
+    code++;
+    if (code == 0xFF) {
+      output[code_index] = code;
+      code_index = out++;
+      code = 1;
+    }
+  }
+  output[code_index] = code;
+  return out;
+}
+
+size_t cobs_decode(const uint8_t* input, size_t length, uint8_t* output) {
+  size_t in = 0, out = 0;
+  while (in < length) {
+    uint8_t code = input[in++];
+    if (code == 0 || in + code - 1 > length) return 0;
+    for (int i = 1; i < code; i++) {
+      if (input[in] == 0) return 0;
+      output[out++] = input[in++];
+    }
+    // Every block but a full one ends in a 0, apart from the last
+    if (code != 0xFF && in < length) output[out++] = 0;
+  }
+  return out;
+}
+
+size_t telemetry_frame(const telemetry_packet& packet, uint8_t* frame) {
+  uint8_t raw[sizeof(telemetry_packet) + 2];
+  memcpy(raw, &packet, sizeof(telemetry_packet));
+  uint16_t crc = telemetry_crc(raw, sizeof(telemetry_packet));
+  raw[sizeof(telemetry_packet)] = crc & 0xFF;
+  raw[sizeof(telemetry_packet) + 1] = crc >> 8;
+
+  frame[0] = 0x00;
+  size_t length = 1 + cobs_encode(raw, sizeof(raw), frame + 1);
+  frame[length++] = 0x00;
+  return length;
+}
+
+bool telemetry_unframe(const uint8_t* frame, size_t length, telemetry_packet& packet) {
+  uint8_t raw[TELEMETRY_FRAME_MAX];
+  if (length > TELEMETRY_FRAME_MAX) return false;
+  if (cobs_decode(frame, length, raw) != sizeof(telemetry_packet) + 2) return false;
+
+  uint16_t crc = raw[sizeof(telemetry_packet)] | raw[sizeof(telemetry_packet) + 1] << 8;
+  if (crc != telemetry_crc(raw, sizeof(telemetry_packet))) return false;
+
+  memcpy(&packet, raw, sizeof(telemetry_packet));
+  return packet.version == TELEMETRY_VERSION;
+}
@@ -0,0 +1,96 @@
+#include "timing.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+#ifdef __arm__
+#include "pros/rtos.h"
+uint32_t timing_micros() { return pros::c::micros(); }
+#else
+#include <chrono>
+uint32_t timing_micros() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+#endif
+
+// Histograms register themselves the first time their scope runs, which can be in any task and
+// in the middle of a report.  Each one claims a slot with an atomic index and then fills it, so
+// nothing is locked or moved, and a slot that's claimed but not filled yet reads as empty.
+// Zero initialized, so it's ready before any histogram registers no matter the initialization order
+static const int HISTOGRAMS_MAX = 64;
+static std::atomic<TimingHistogram*> registered[HISTOGRAMS_MAX];
+static std::atomic<int> registered_count{0};
+
+TimingHistogram::TimingHistogram(const char* name) : name(name) {
+  int slot = registered_count.fetch_add(1);
+  if (slot < HISTOGRAMS_MAX) registered[slot].store(this);
+}
+
+// Runs f on every registered histogram
+template <typename F>
+static void histograms_each(F f) {
+  int count = std::min(registered_count.load(), HISTOGRAMS_MAX);
+  for (int i = 0; i < count; i++) {
+    TimingHistogram* histogram = registered[i].load();
+    if (histogram != nullptr) f(histogram);
+  }
+}
+
+void TimingHistogram::add(uint32_t micros) {
+  // Bucket is the number of bits needed to hold the time, so each one is twice as wide as the last
+  int bucket = micros == 0 ? 0 : 32 - __builtin_clz(micros);
+  if (bucket >= BUCKETS) bucket = BUCKETS - 1;
+  buckets[bucket]++;
+  count++;
+  total += micros;
+  if (micros > max) max = micros;
+}
+
+void TimingHistogram::reset() {
+  for (int i = 0; i < BUCKETS; i++) buckets[i] = 0;
+  count = 0;
+  total = 0;
+  max = 0;
+}
+
+uint32_t TimingHistogram::percentile_get(double fraction) const {
+  if (count == 0) return 0;
+  uint32_t needed = fraction * count;
+  uint32_t seen = 0;
+  for (int i = 0; i < BUCKETS - 1; i++) {
+    seen += buckets[i];
+    if (seen > needed) return std::min(1u << i, max);  // Upper edge of bucket i
+  }
+  return max;
+}
+
+void timing_report(FILE* out) {
+  if (registered_count.load() == 0) return;
+  if (registered_count.load() > HISTOGRAMS_MAX)
+    fprintf(out, "\n%i timed scopes, only the first %i are kept\n", registered_count.load(), HISTOGRAMS_MAX);
+
+  fprintf(out, "\n%-24s %8s %8s %8s %8s %8s\n", "scope", "count", "mean", "p50", "p99", "max");
+  histograms_each([out](TimingHistogram* histogram) {
+    uint32_t count = histogram->count_get();
+    if (count == 0) return;
+    fprintf(out, "%-24s %8u %8.1f %8u %8u %8u\n", histogram->name, count,
+            (double)histogram->total_get() / count, histogram->percentile_get(0.5),
+            histogram->percentile_get(0.99), histogram->max_get());
+  });
+
+  // Bucket counts, labelled by the shortest time that lands in each
+  fprintf(out, "\n%-24s", "us >=");
+  for (int i = 0; i < TimingHistogram::BUCKETS; i++) fprintf(out, " %6u", i == 0 ? 0 : 1u << (i - 1));
+  fprintf(out, "\n");
+  histograms_each([out](TimingHistogram* histogram) {
+    if (histogram->count_get() == 0) return;
+    fprintf(out, "%-24s", histogram->name);
+    for (int i = 0; i < TimingHistogram::BUCKETS; i++) fprintf(out, " %6u", histogram->bucket_get(i));
+    fprintf(out, "\n");
+  });
+}
+
+void timing_reset() {
+  histograms_each([](TimingHistogram* histogram) { histogram->reset(); });
+}
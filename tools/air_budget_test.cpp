@@ -0,0 +1,86 @@
+// AirTank host test.
+//
+// Checks cylinder volumes, that each actuation leaves the pressure Boyle's law says it should, and
+// how many actuations a tank is good for.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/air_budget_test.cpp src/air_budget.cpp -o air_budget_test
+//   ./air_budget_test
+
+#include <cmath>
+
+#include "air_budget.hpp"
+#include "host_test.hpp"
+
+namespace {
+
+const double ATMOSPHERE = 14.7;  // psi absolute
+
+void test_cylinder_volumes() {
+  Cylinder single = {0.75, 2.0};
+  CHECK_NEAR(single.extend_volume(), M_PI * 0.75 * 0.75 / 4 * 2, 1e-9);
+  CHECK_NEAR(single.retract_volume(), 0, 1e-12);  // The spring brings it back
+
+  Cylinder double_acting = {0.75, 2.0, 0.25, true, 0.3};
+  CHECK_NEAR(double_acting.extend_volume(), M_PI * 0.75 * 0.75 / 4 * 2 + 0.3, 1e-9);
+  CHECK_NEAR(double_acting.retract_volume(), M_PI * (0.75 * 0.75 - 0.25 * 0.25) / 4 * 2 + 0.3, 1e-9);
+  CHECK(double_acting.retract_volume() < double_acting.extend_volume());
+}
+
+// The gauge formula matches doing Boyle's law in absolute pressure, with the cylinder starting
+// at atmosphere
+void test_matches_boyle() {
+  AirTank tank;
+  const double cylinder = 1.5;
+  double absolute = tank.constants.start_pressure + ATMOSPHERE;
+  for (int i = 0; i < 10; i++) {
+    tank.use(cylinder);
+    absolute = (absolute * tank.constants.volume + ATMOSPHERE * cylinder) / (tank.constants.volume + cylinder);
+    CHECK_NEAR(tank.pressure_get(), absolute - ATMOSPHERE, 1e-9);
+  }
+}
+
+// Every actuation drops the pressure by the same ratio, so the count to min_pressure is a log
+void test_actuations_available() {
+  AirTank tank;
+  Cylinder cylinder = {0.75, 2.0, 0.25, true, 0.3};
+  double ratio = tank.constants.volume / (tank.constants.volume + cylinder.extend_volume());
+  int expected = std::floor(std::log(tank.constants.min_pressure / tank.constants.start_pressure) / std::log(ratio));
+
+  int actuations = 0;
+  while (tank.usable(tank.pressure_after(tank.pressure_get(), cylinder.extend_volume()))) {
+    tank.use(cylinder.extend_volume());
+    actuations++;
+  }
+  CHECK(actuations == expected);
+  CHECK(tank.usable(tank.pressure_get()));
+}
+
+void test_refill() {
+  AirTank tank({24.4, 120, 50});  // Two tanks pumped higher
+  CHECK_NEAR(tank.pressure_get(), 120, 1e-12);
+  tank.use(5);
+  CHECK_NEAR(tank.pressure_get(), 120 * 24.4 / 29.4, 1e-9);
+  tank.refill();
+  CHECK_NEAR(tank.pressure_get(), 120, 1e-12);
+}
+
+void test_nothing_used() {
+  AirTank tank;
+  tank.use(0);
+  tank.use(-2);
+  CHECK_NEAR(tank.pressure_get(), tank.constants.start_pressure, 1e-12);
+  CHECK(tank.usable(tank.constants.min_pressure));
+  CHECK(!tank.usable(tank.constants.min_pressure - 0.1));
+}
+
+}  // namespace
+
+int main() {
+  test_cylinder_volumes();
+  test_matches_boyle();
+  test_actuations_available();
+  test_refill();
+  test_nothing_used();
+  return host_test_result();
+}
@@ -0,0 +1,134 @@
+// BallQueue host test.
+//
+// Feeds balls in and runs the conveyor stages forwards, backwards and with the top stage held,
+// and checks where the queue thinks every ball is and what it counted as scored or ejected.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/ball_queue_test.cpp src/ball_queue.cpp -o ball_queue_test
+//   ./ball_queue_test
+
+#include "ball_queue.hpp"
+#include "host_test.hpp"
+
+namespace {
+
+// Runs both stages for some ticks, in per tick
+void run(BallQueue& queue, int ticks, double bottom, double top, bool ejecting = false) {
+  for (int i = 0; i < ticks; i++) queue.advance(bottom, top, ejecting);
+}
+
+void test_moves_along() {
+  BallQueue queue;
+  queue.enter();
+  CHECK(queue.count_get() == 1);
+  CHECK_NEAR(queue.position_get(0), 0, 1e-12);
+  run(queue, 4, 1.0, 1.0);
+  CHECK_NEAR(queue.position_get(0), 4, 1e-12);
+
+  // Past the bottom stage, the top stage's travel moves it
+  run(queue, 7, 1.0, 0.5);
+  CHECK_NEAR(queue.position_get(0), 10 + 0.5, 1e-12);
+}
+
+// Intaking holds balls below the top stage
+void test_waits_at_top_stage() {
+  BallQueue queue;
+  queue.enter();
+  run(queue, 30, 1.0, 0.0);
+  CHECK_NEAR(queue.position_get(0), queue.constants.bottom_length, 1e-12);
+  CHECK(queue.count_get() == 1);
+  CHECK(queue.scored_get() == 0);
+}
+
+// Balls stack up behind each other a ball apart
+void test_spacing() {
+  BallQueue queue;
+  for (int i = 0; i < 3; i++) {
+    queue.enter();
+    run(queue, 2, 1.0, 0.0);
+  }
+  run(queue, 30, 1.0, 0.0);
+  const BallQueue::Constants& c = queue.constants;
+  CHECK(queue.count_get() == 3);
+  CHECK_NEAR(queue.position_get(0), c.bottom_length, 1e-12);
+  CHECK_NEAR(queue.position_get(1), c.bottom_length - c.ball_spacing, 1e-12);
+  CHECK_NEAR(queue.position_get(2), c.bottom_length - 2 * c.ball_spacing, 1e-12);
+}
+
+void test_scores() {
+  BallQueue queue;
+  for (int i = 0; i < 3; i++) {
+    queue.enter();
+    run(queue, 4, 1.0, 0.0);
+  }
+  run(queue, 60, 1.0, 1.0);
+  CHECK(queue.count_get() == 0);
+  CHECK(queue.scored_get() == 3);
+  CHECK(queue.ejected_get() == 0);
+
+  queue.scored_reset();
+  CHECK(queue.scored_get() == 0);
+}
+
+// Thrown out the back by the color sorter, not scored
+void test_ejects() {
+  BallQueue queue;
+  queue.enter();
+  run(queue, 60, 1.0, 1.0, true);
+  CHECK(queue.count_get() == 0);
+  CHECK(queue.scored_get() == 0);
+  CHECK(queue.ejected_get() == 1);
+}
+
+// Outtaking pushes balls back out the intake without scoring them
+void test_reverse() {
+  BallQueue queue;
+  queue.enter();
+  run(queue, 3, 1.0, 1.0);
+  queue.enter();
+  run(queue, 1, 1.0, 1.0);
+  CHECK(queue.count_get() == 2);
+  run(queue, 2, -1.0, -1.0);
+  CHECK(queue.count_get() == 1);
+  CHECK_NEAR(queue.position_get(0), 2, 1e-12);
+  run(queue, 10, -1.0, -1.0);
+  CHECK(queue.count_get() == 0);
+  CHECK(queue.scored_get() == 0);
+}
+
+void test_full() {
+  BallQueue queue;
+  for (int i = 0; i < queue.constants.capacity - 1; i++) queue.enter();
+  CHECK(!queue.full());
+  queue.enter();
+  CHECK(queue.full());
+
+  // Counting keeps going past capacity up to MAX_BALLS, then stops
+  for (int i = 0; i < 10; i++) queue.enter();
+  CHECK(queue.count_get() == BallQueue::MAX_BALLS);
+
+  queue.clear();
+  CHECK(queue.count_get() == 0);
+  CHECK(!queue.full());
+}
+
+void test_out_of_range() {
+  BallQueue queue;
+  queue.enter();
+  CHECK_NEAR(queue.position_get(-1), 0, 1e-12);
+  CHECK_NEAR(queue.position_get(5), 0, 1e-12);
+}
+
+}  // namespace
+
+int main() {
+  test_moves_along();
+  test_waits_at_top_stage();
+  test_spacing();
+  test_scores();
+  test_ejects();
+  test_reverse();
+  test_full();
+  test_out_of_range();
+  return host_test_result();
+}
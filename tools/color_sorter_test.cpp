@@ -0,0 +1,226 @@
+// ColorSorter host test.
+//
+// Runs balls past the sensor on a moving belt and checks which ones get ejected, that the eject
+// lands at the eject point at any belt speed, that changing the alliance changes what's thrown
+// out, and that reset() drops ejects that were waiting.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/color_sorter_test.cpp src/color_sorter.cpp -o color_sorter_test
+//   ./color_sorter_test
+
+#include <cmath>
+#include <vector>
+
+#include "color_sorter.hpp"
+#include "host_test.hpp"
+
+namespace {
+
+const double DT = 0.01;  // s, the subsystem task's period
+
+// A ball on the belt, in front of the sensor while the belt is within half its width of where it sits
+struct ball {
+  double position;  // belt position when it's centered on the sensor, in
+  double hue;
+};
+
+// Belt position of every eject that started, and how far the belt went while each one ran
+struct ejects {
+  std::vector<double> starts;
+  std::vector<double> lengths;
+};
+
+// What the sensor sees at a belt position
+void sense(const std::vector<ball>& balls, double position, double& hue, int& proximity) {
+  hue = 90;  // Green, the empty belt
+  proximity = 20;
+  for (const auto& b : balls) {
+    if (std::fabs(position - b.position) < 1.25) {
+      hue = b.hue;
+      proximity = 200;
+    }
+  }
+}
+
+// Runs the belt at a speed until it's gone some distance
+ejects run(ColorSorter& sorter, const std::vector<ball>& balls, double velocity, double distance, double& position) {
+  ejects out;
+  bool was_ejecting = false;
+  double end = position + distance;
+  while (position < end) {
+    double hue;
+    int proximity;
+    sense(balls, position, hue, proximity);
+    bool ejecting = sorter.iterate(hue, proximity, position, velocity);
+    if (ejecting && !was_ejecting) {
+      out.starts.push_back(position);
+      out.lengths.push_back(0);
+    } else if (ejecting) {
+      out.lengths.back() += velocity * DT;
+    }
+    was_ejecting = ejecting;
+    position += velocity * DT;
+  }
+  return out;
+}
+
+ejects run(ColorSorter& sorter, const std::vector<ball>& balls, double velocity = 20, double distance = 40) {
+  double position = 0;
+  return run(sorter, balls, velocity, distance, position);
+}
+
+void test_keeps_alliance() {
+  ColorSorter sorter;
+  sorter.alliance_set(BALL_RED);
+  ejects e = run(sorter, {{5, 10}, {10, 5}, {15, 350}});
+  CHECK(e.starts.empty());
+  CHECK(sorter.ejected_get() == 0);
+}
+
+void test_ejects_other_color() {
+  ColorSorter sorter;
+  sorter.alliance_set(BALL_RED);
+  ejects e = run(sorter, {{5, 10}, {10, 220}, {15, 10}});
+  CHECK(e.starts.size() == 1);
+  CHECK(sorter.ejected_get() == 1);
+}
+
+// The eject moves actuator_delay after it's told to, by then the ball is at the eject point
+void test_eject_timing() {
+  for (double velocity : {5.0, 10.0, 20.0, 40.0, 60.0}) {
+    ColorSorter sorter;
+    sorter.alliance_set(BALL_BLUE);
+    ejects e = run(sorter, {{5, 10}}, velocity);
+    CHECK(e.starts.size() == 1);
+    if (e.starts.size() != 1) continue;
+
+    // The sensor is read every tick, so the ball is first seen on the first tick past the edge of it
+    double seen = 0;
+    while (seen <= 5 - 1.25) seen += velocity * DT;
+    double moves = e.starts[0] + velocity * sorter.constants.actuator_delay / 1000.0;
+    double target = seen + sorter.constants.eject_distance;
+    CHECK(moves >= target - 1e-9);
+    CHECK(moves < target + velocity * DT + 1e-9);  // Late by less than one tick of belt
+  }
+}
+
+// Keeps ejecting for eject_length of belt, give or take a tick
+void test_eject_length() {
+  ColorSorter sorter;
+  sorter.alliance_set(BALL_BLUE);
+  const double velocity = 20;
+  ejects e = run(sorter, {{5, 10}}, velocity);
+  CHECK(e.lengths.size() == 1);
+  if (e.lengths.size() == 1) CHECK_NEAR(e.lengths[0], sorter.constants.eject_length, velocity * DT + 1e-9);
+}
+
+// Balls closer together than the sensor is to the eject point queue up
+void test_several_waiting() {
+  ColorSorter sorter;
+  sorter.alliance_set(BALL_RED);
+  ejects e = run(sorter, {{5, 220}, {9.5, 220}, {14, 10}, {18.5, 220}}, 20, 60);
+  CHECK(e.starts.size() == 3);
+  CHECK(sorter.ejected_get() == 3);
+  for (size_t i = 1; i < e.starts.size(); i++) CHECK(e.starts[i] > e.starts[i - 1]);
+}
+
+// The routes set the alliance, so flipping it throws out the other color from then on
+void test_alliance_flip() {
+  ColorSorter sorter;
+  sorter.alliance_set(BALL_RED);
+  double position = 0;
+  ejects red = run(sorter, {{5, 220}, {10, 10}}, 20, 20, position);
+  CHECK(red.starts.size() == 1);
+
+  sorter.alliance_set(BALL_BLUE);
+  CHECK(sorter.alliance_get() == BALL_BLUE);
+  ejects blue = run(sorter, {{25, 220}, {30, 10}, {35, 10}}, 20, 30, position);
+  CHECK(blue.starts.size() == 2);
+  CHECK(sorter.ejected_get() == 3);
+
+  // Nothing gets thrown out without an alliance
+  sorter.alliance_set(BALL_NONE);
+  ejects none = run(sorter, {{55, 220}, {60, 10}}, 20, 30, position);
+  CHECK(none.starts.empty());
+}
+
+// Stopping or reversing the conveyor drops ejects that were waiting for their ball
+void test_reset() {
+  ColorSorter sorter;
+  sorter.alliance_set(BALL_RED);
+  double position = 0;
+  run(sorter, {{5, 220}}, 20, 7, position);  // Seen, but not at the eject point yet
+  CHECK(sorter.ejected_get() == 0);
+  sorter.reset();
+  ejects after = run(sorter, {}, 20, 30, position);
+  CHECK(after.starts.empty());
+  CHECK(sorter.ejected_get() == 0);
+
+  // Still sorts the next ball
+  ejects next = run(sorter, {{45, 220}}, 20, 30, position);
+  CHECK(next.starts.size() == 1);
+}
+
+// reset() in the middle of an eject stops it
+void test_reset_while_ejecting() {
+  ColorSorter sorter;
+  sorter.alliance_set(BALL_RED);
+  double position = 0;
+  double hue;
+  int proximity;
+  bool ejecting = false;
+  while (!ejecting && position < 40) {
+    sense({{5, 220}}, position, hue, proximity);
+    ejecting = sorter.iterate(hue, proximity, position, 20);
+    position += 20 * DT;
+  }
+  CHECK(ejecting);
+  sorter.reset();
+  CHECK(!sorter.iterate(90, 20, position, 20));
+}
+
+// A hue drifting past the enter band but inside the exit band keeps its color, and a proximity
+// dipping between the thresholds doesn't make one ball count twice
+void test_hysteresis() {
+  ColorSorter sorter;
+  sorter.alliance_set(BALL_RED);
+  const ColorSorter::Constants& c = sorter.constants;
+  double position = 0;
+  sorter.iterate(c.blue_hue, 200, position, 20);
+  CHECK(sorter.color_get() == BALL_BLUE);
+  sorter.iterate(c.blue_hue + (c.enter_band + c.exit_band) / 2, 200, position += 0.2, 20);
+  CHECK(sorter.color_get() == BALL_BLUE);
+  sorter.iterate(c.blue_hue, (c.proximity_enter + c.proximity_exit) / 2, position += 0.2, 20);
+  sorter.iterate(c.blue_hue, 200, position += 0.2, 20);
+  sorter.iterate(c.blue_hue + c.exit_band + 5, 200, position += 0.2, 20);
+  CHECK(sorter.color_get() == BALL_NONE);
+
+  run(sorter, {}, 20, 20, position);
+  CHECK(sorter.ejected_get() == 1);
+}
+
+// Red sits across 0, so hues just under 360 are red too
+void test_hue_wraps() {
+  ColorSorter sorter;
+  sorter.iterate(355, 200, 0, 0);
+  CHECK(sorter.color_get() == BALL_RED);
+  ColorSorter far;
+  far.iterate(300, 200, 0, 0);
+  CHECK(far.color_get() == BALL_NONE);
+}
+
+}  // namespace
+
+int main() {
+  test_keeps_alliance();
+  test_ejects_other_color();
+  test_eject_timing();
+  test_eject_length();
+  test_several_waiting();
+  test_alliance_flip();
+  test_reset();
+  test_reset_while_ejecting();
+  test_hysteresis();
+  test_hue_wraps();
+  return host_test_result();
+}
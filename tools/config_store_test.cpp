@@ -0,0 +1,171 @@
+// ConfigStore host test.
+//
+// Checks version handling, unknown and bad lines, keys whose hashes collide, and that text
+// written by write() parses back to the same values.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/config_store_test.cpp src/config_store.cpp -o config_store_test
+//   ./config_store_test
+
+#include <cstring>
+
+#include "config_store.hpp"
+#include "host_test.hpp"
+
+namespace {
+
+// These two FNV-1a hashes are both 0x5564f986
+const char* COLLIDE_A = "key583084";
+const char* COLLIDE_B = "key1092000";
+
+struct settings {
+  double kp = 1.0;
+  double kd = 2.0;
+  int count = 3;
+};
+
+void bind(ConfigStore& store, settings& s) {
+  store.add("pid.kp", &s.kp);
+  store.add("pid.kd", &s.kd);
+  store.add("count", &s.count);
+}
+
+void test_load() {
+  ConfigStore store(2);
+  settings s;
+  bind(store, s);
+  ConfigStore::load_result result = store.parse(
+      "# tuned on the practice field\n"
+      "version=2\n"
+      "  pid.kp = 4.5\r\n"
+      "\n"
+      "count=7\n");
+  CHECK(result.accepted);
+  CHECK(result.version == 2);
+  CHECK(result.loaded == 2);
+  CHECK_NEAR(s.kp, 4.5, 1e-12);
+  CHECK_NEAR(s.kd, 2.0, 1e-12);
+  CHECK(s.count == 7);
+}
+
+void test_version_mismatch() {
+  ConfigStore store(2);
+  settings s;
+  bind(store, s);
+  ConfigStore::load_result result = store.parse("version=1\npid.kp=9\n");
+  CHECK(!result.accepted);
+  CHECK(result.version == 1);
+  CHECK(result.loaded == 0);
+  CHECK_NEAR(s.kp, 1.0, 1e-12);
+
+  result = store.parse("version=2.5\npid.kp=9\n");
+  CHECK(!result.accepted);
+  CHECK(result.version == -1);
+  CHECK_NEAR(s.kp, 1.0, 1e-12);
+}
+
+void test_missing_version() {
+  ConfigStore store(2);
+  settings s;
+  bind(store, s);
+  ConfigStore::load_result result = store.parse("pid.kp=9\nversion=2\n");
+  CHECK(!result.accepted);
+  CHECK(result.version == -1);
+  CHECK_NEAR(s.kp, 1.0, 1e-12);
+
+  result = store.parse("");
+  CHECK(!result.accepted);
+  CHECK(result.version == -1);
+}
+
+void test_unknown_and_bad() {
+  ConfigStore store(2);
+  settings s;
+  bind(store, s);
+  ConfigStore::load_result result = store.parse(
+      "version=2\n"
+      "pid.ki=0.1\n"    // unknown
+      "pid.kp\n"        // no value
+      "pid.kd=fast\n"   // not a number
+      "pid.kd=3 4\n"    // junk after the number
+      "pid.kd=\n"       // empty
+      "count=5");       // no newline at the end
+  CHECK(result.accepted);
+  CHECK(result.unknown == 1);
+  CHECK(result.bad == 4);
+  CHECK(result.loaded == 1);
+  CHECK_NEAR(s.kd, 2.0, 1e-12);
+  CHECK(s.count == 5);
+}
+
+void test_collisions() {
+  CHECK(config_hash(COLLIDE_A, strlen(COLLIDE_A)) == config_hash(COLLIDE_B, strlen(COLLIDE_B)));
+
+  ConfigStore store(1);
+  double a = 0, b = 0, c = 0;
+  CHECK(store.add("c", &c));
+  CHECK(store.add(COLLIDE_B, &b));
+  CHECK(store.add(COLLIDE_A, &a));
+  CHECK(!store.add(COLLIDE_A, &c));  // already bound
+  ConfigStore::load_result result = store.parse("version=1\nkey583084=1\nkey1092000=2\nkey583085=3\n");
+  CHECK(result.loaded == 2);
+  CHECK(result.unknown == 1);
+  CHECK_NEAR(a, 1, 1e-12);
+  CHECK_NEAR(b, 2, 1e-12);
+  CHECK_NEAR(c, 0, 1e-12);
+}
+
+void test_full() {
+  ConfigStore store(1);
+  static char keys[ConfigStore::KEYS_MAX + 1][8];
+  double value = 0;
+  for (int i = 0; i < ConfigStore::KEYS_MAX; i++) {
+    snprintf(keys[i], sizeof(keys[i]), "k%d", i);
+    CHECK(store.add(keys[i], &value));
+  }
+  snprintf(keys[ConfigStore::KEYS_MAX], sizeof(keys[0]), "extra");
+  CHECK(!store.add(keys[ConfigStore::KEYS_MAX], &value));
+  CHECK(store.count_get() == ConfigStore::KEYS_MAX);
+}
+
+void test_round_trip() {
+  ConfigStore store(3);
+  settings s;
+  bind(store, s);
+  s.kp = 0.123456;
+  s.kd = -250.5;
+  s.count = -12;
+
+  char buffer[256];
+  size_t length = store.write(buffer, sizeof(buffer));
+  CHECK(length > 0);
+  CHECK(length == strlen(buffer));
+  CHECK(strncmp(buffer, "version=3\npid.kp=", 17) == 0);  // Bound order, not hash order
+
+  settings loaded;
+  ConfigStore reader(3);
+  bind(reader, loaded);
+  ConfigStore::load_result result = reader.parse(buffer);
+  CHECK(result.accepted);
+  CHECK(result.loaded == 3);
+  CHECK(result.unknown == 0 && result.bad == 0);
+  CHECK_NEAR(loaded.kp, s.kp, 1e-9);
+  CHECK_NEAR(loaded.kd, s.kd, 1e-9);
+  CHECK(loaded.count == s.count);
+
+  // Too small a buffer writes nothing instead of half a file
+  CHECK(store.write(buffer, 20) == 0);
+}
+
+}  // namespace
+
+int main() {
+  test_load();
+  test_version_mismatch();
+  test_missing_version();
+  test_unknown_and_bad();
+  test_collisions();
+  test_full();
+  test_round_trip();
+  return host_test_result();
+}
@@ -0,0 +1,119 @@
+// ControllerQueue host test.
+//
+// Checks writes to a line that's still waiting replace it instead of queueing behind it, that
+// higher priority goes first and equal priority goes oldest first, and that text is cut to fit.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/controller_queue_test.cpp src/controller_queue.cpp -o controller_queue_test
+//   ./controller_queue_test
+
+#include <cstdio>
+#include <cstring>
+
+#include "controller_queue.hpp"
+#include "host_test.hpp"
+
+namespace {
+
+bool pops(ControllerQueue& queue, int slot, const char* text) {
+  ControllerQueue::message out;
+  if (!queue.pop(out)) return false;
+  return out.slot == slot && strcmp(out.text, text) == 0;
+}
+
+void test_empty() {
+  ControllerQueue queue;
+  ControllerQueue::message out;
+  CHECK(queue.pending_get() == 0);
+  CHECK(!queue.pop(out));
+}
+
+// Only the newest text for a line is sent
+void test_coalesces() {
+  ControllerQueue queue;
+  for (int i = 0; i < 50; i++) {
+    char text[ControllerQueue::TEXT_SIZE];
+    snprintf(text, sizeof(text), "count %d", i);
+    queue.text(1, 0, text);
+  }
+  CHECK(queue.pending_get() == 1);
+  CHECK(pops(queue, 1, "count 49"));
+  CHECK(queue.pending_get() == 0);
+
+  queue.rumble(0, ".");
+  queue.rumble(0, "--");
+  CHECK(queue.pending_get() == 1);
+  CHECK(pops(queue, ControllerQueue::RUMBLE, "--"));
+}
+
+// Equal priority goes in the order the slots were first written
+void test_oldest_first() {
+  ControllerQueue queue;
+  queue.text(2, 0, "c");
+  queue.text(0, 0, "a");
+  queue.rumble(0, ".");
+  queue.text(1, 0, "b");
+  queue.text(2, 0, "c again");  // Keeps its place at the front
+  CHECK(queue.pending_get() == 4);
+  CHECK(pops(queue, 2, "c again"));
+  CHECK(pops(queue, 0, "a"));
+  CHECK(pops(queue, ControllerQueue::RUMBLE, "."));
+  CHECK(pops(queue, 1, "b"));
+  CHECK(queue.pending_get() == 0);
+}
+
+void test_priority() {
+  ControllerQueue queue;
+  queue.text(0, 0, "low");
+  queue.text(1, 5, "high");
+  queue.rumble(2, "-");
+  CHECK(pops(queue, 1, "high"));
+  CHECK(pops(queue, ControllerQueue::RUMBLE, "-"));
+  CHECK(pops(queue, 0, "low"));
+}
+
+// Overwriting a waiting line with a lower priority keeps the higher one, so a warning can't be
+// pushed back by the routine refresh of the same line
+void test_priority_kept() {
+  ControllerQueue queue;
+  queue.text(0, 0, "status");
+  queue.text(1, 3, "WARNING");
+  queue.text(1, 0, "refresh");
+  CHECK(pops(queue, 1, "refresh"));
+  CHECK(pops(queue, 0, "status"));
+
+  // Once sent, the next write starts fresh at its own priority and goes to the back
+  queue.text(0, 0, "status");
+  queue.text(1, 0, "refresh");
+  CHECK(pops(queue, 0, "status"));
+  CHECK(pops(queue, 1, "refresh"));
+}
+
+void test_truncates() {
+  ControllerQueue queue;
+  queue.text(0, 0, "this line is much too long for the controller");
+  ControllerQueue::message out;
+  CHECK(queue.pop(out));
+  CHECK(strlen(out.text) == ControllerQueue::TEXT_SIZE - 1);
+  CHECK(strncmp(out.text, "this line is much t", ControllerQueue::TEXT_SIZE - 1) == 0);
+}
+
+void test_bad_line() {
+  ControllerQueue queue;
+  queue.text(-1, 0, "no");
+  queue.text(ControllerQueue::LINES, 0, "no");  // That's the rumble slot
+  CHECK(queue.pending_get() == 0);
+}
+
+}  // namespace
+
+int main() {
+  test_empty();
+  test_coalesces();
+  test_oldest_first();
+  test_priority();
+  test_priority_kept();
+  test_truncates();
+  test_bad_line();
+  return host_test_result();
+}
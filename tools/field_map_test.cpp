@@ -0,0 +1,96 @@
+// FieldTransform and TrailDecimator host test.
+//
+// Checks field points land on the right map pixels, points off the field stay on the map, and the
+// trail only keeps points that moved far enough to show.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/field_map_test.cpp src/field_map.cpp -o field_map_test
+//   ./field_map_test
+
+#include <cmath>
+
+#include "field_map.hpp"
+#include "host_test.hpp"
+
+namespace {
+
+void test_corners() {
+  FieldTransform map;  // 144 in field on 200 px
+  CHECK_NEAR(map.scale_get(), 200 / 144.0, 1e-12);
+
+  map_point center = map.to_pixel(0, 0);
+  CHECK(center.x == 100 && center.y == 100);
+
+  // +y is up the screen, so the top left of the field is (0, 0) on the map
+  map_point top_left = map.to_pixel(-72, 72);
+  CHECK(top_left.x == 0 && top_left.y == 0);
+  map_point bottom_right = map.to_pixel(71.9, -71.9);
+  CHECK(bottom_right.x == 199 && bottom_right.y == 199);
+
+  map_point up = map.to_pixel(0, 36);
+  CHECK(up.x == 100 && up.y == 50);
+  map_point right = map.to_pixel(36, 0);
+  CHECK(right.x == 150 && right.y == 100);
+}
+
+void test_off_field() {
+  FieldTransform map;
+  map_point far = map.to_pixel(500, -500);
+  CHECK(far.x == 199 && far.y == 199);
+  map_point far_other = map.to_pixel(-500, 500);
+  CHECK(far_other.x == 0 && far_other.y == 0);
+  map_point edge = map.to_pixel(72, 0);  // Exactly on the edge rounds to 200, one past the map
+  CHECK(edge.x == 199);
+}
+
+// Every point on the field lands on the map, and neighbouring inches are a scale apart
+void test_sweep() {
+  FieldTransform map(144, 240);
+  bool inside = true;
+  double worst = 0;
+  for (double x = -80; x <= 80; x += 0.5) {
+    for (double y = -80; y <= 80; y += 0.5) {
+      map_point p = map.to_pixel(x, y);
+      inside &= p.x >= 0 && p.x < 240 && p.y >= 0 && p.y < 240;
+      if (std::fabs(x) < 70 && std::fabs(y) < 70) {
+        double expected_x = (x + 72) * map.scale_get();
+        worst = std::fmax(worst, std::fabs(p.x - expected_x));
+      }
+    }
+  }
+  CHECK(inside);
+  CHECK(worst <= 0.5 + 1e-9);
+}
+
+void test_decimator() {
+  TrailDecimator trail(3);
+  CHECK(trail.keep({50, 50}));   // First point always
+  CHECK(!trail.keep({50, 50}));  // Sitting still
+  CHECK(!trail.keep({52, 52}));  // 2.8 px
+  CHECK(trail.keep({53, 50}));   // 3 px from the last kept
+  CHECK(!trail.keep({55, 51}));  // Measured from the last kept, not the last seen
+  CHECK(trail.keep({56, 50}));
+
+  trail.reset();
+  CHECK(trail.keep({56, 50}));  // A new trail starts where it is
+}
+
+// A robot creeping along one pixel a tick adds a point every min_pixels ticks
+void test_decimator_creep() {
+  TrailDecimator trail(4);
+  int kept = 0;
+  for (int16_t x = 0; x <= 100; x++)
+    if (trail.keep({x, 10})) kept++;
+  CHECK(kept == 100 / 4 + 1);
+}
+
+}  // namespace
+
+int main() {
+  test_corners();
+  test_off_field();
+  test_sweep();
+  test_decimator();
+  test_decimator_creep();
+  return host_test_result();
+}
@@ -0,0 +1,93 @@
+// Flight log decoder.
+//
+// Reads a /usd/flightNN.bin log written by the flight recorder (see include/flight_log.hpp) and
+// writes it out as CSV, one row per sample.  Why the log was written and how long it covers go to
+// stderr.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/flight_decode.cpp src/flight_log.cpp -o flight_decode
+//   ./flight_decode flight00.bin -o flight00.csv
+//
+// Without -o the CSV goes to stdout.  Times in the CSV are ms before the log was written.
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "flight_log.hpp"
+
+namespace {
+
+void csv_header(FILE* out) {
+  fprintf(out,
+          "time,x,y,theta,drive_mode,left_voltage,right_voltage,left_current,right_current,"
+          "subsystem_state,intake_current,bottom_current,top_current,outtake_current,battery,"
+          "enabled,autonomous,interfered\n");
+}
+
+void csv_row(FILE* out, const flight_sample& s, uint32_t end) {
+  fprintf(out, "%d,%.3f,%.3f,%.3f,%u,%d,%d,%d,%d,%u,%d,%d,%d,%d,%u,%d,%d,%d\n",
+          (int)(s.time - end), s.x, s.y, s.theta, s.drive_mode, s.left_voltage, s.right_voltage,
+          s.left_current, s.right_current, s.subsystem_state, s.intake_current, s.bottom_current,
+          s.top_current, s.outtake_current, s.battery, (s.flags & FLIGHT_FLAG_ENABLED) != 0,
+          (s.flags & FLIGHT_FLAG_AUTONOMOUS) != 0, (s.flags & FLIGHT_FLAG_INTERFERED) != 0);
+}
+
+void usage() { fprintf(stderr, "usage: flight_decode [-o output.csv] flightNN.bin\n"); }
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::string input, output;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output = argv[++i];
+    } else if (argv[i][0] == '-') {
+      usage();
+      return 1;
+    } else {
+      input = argv[i];
+    }
+  }
+  if (input.empty()) {
+    usage();
+    return 1;
+  }
+
+  FILE* in = fopen(input.c_str(), "rb");
+  if (in == nullptr) {
+    perror(input.c_str());
+    return 1;
+  }
+
+  flight_log_header header;
+  if (!flight_log_read_header(in, header)) {
+    fprintf(stderr, "%s isn't a version %u flight log\n", input.c_str(), FLIGHT_LOG_VERSION);
+    return 1;
+  }
+
+  FILE* out = output.empty() ? stdout : fopen(output.c_str(), "w");
+  if (out == nullptr) {
+    perror(output.c_str());
+    return 1;
+  }
+
+  csv_header(out);
+  int samples = 0;
+  uint32_t first = 0, last = 0;
+  flight_sample sample;
+  while (samples < header.count && fread(&sample, sizeof(sample), 1, in) == 1) {
+    if (samples == 0) first = sample.time;
+    last = sample.time;
+    csv_row(out, sample, header.time);
+    samples++;
+  }
+
+  if (out != stdout) fclose(out);
+  fclose(in);
+
+  fprintf(stderr, "%s log written at %.2f s, %d samples covering %.2f s\n", flight_reason_to_string(header.reason),
+          header.time / 1000.0, samples, (last - first) / 1000.0);
+  if (samples < header.count) fprintf(stderr, "log is cut short, expected %u samples\n", header.count);
+  return 0;
+}
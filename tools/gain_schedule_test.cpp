@@ -0,0 +1,93 @@
+// GainTable host test.
+//
+// Checks that scheduled constants hit the table at its breakpoints, interpolate between them,
+// clamp outside the table, and never jump as the magnitude or voltage sweeps across a cell edge.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/gain_schedule_test.cpp -o gain_schedule_test
+//   ./gain_schedule_test
+
+#include "gain_table.hpp"
+#include "host_test.hpp"
+
+namespace {
+
+struct constants {
+  double kp;
+  double ki;
+  double kd;
+  double start_i;
+};
+
+using Table = GainTable<constants>;
+
+// Same shape as turn_schedule in src/autons.cpp
+const Table table(0, 180, 11500, 12800, {{
+    {{{4.9, 0.09, 23.0, 15.0}, {4.7, 0.085, 22.0, 15.0}, {4.5, 0.08, 21.0, 15.0}}},
+    {{{3.8, 0.065, 21.0, 15.0}, {3.6, 0.06, 20.5, 15.0}, {3.4, 0.055, 20.0, 15.0}}},
+    {{{3.3, 0.055, 21.0, 15.0}, {3.15, 0.05, 20.5, 15.0}, {3.0, 0.05, 20.0, 15.0}}},
+    {{{3.0, 0.045, 23.0, 15.0}, {2.85, 0.04, 22.5, 15.0}, {2.7, 0.04, 22.0, 15.0}}},
+}});
+
+void test_breakpoints() {
+  CHECK_NEAR(table.get(0, 11500).kp, 4.9, 1e-9);
+  CHECK_NEAR(table.get(60, 12150).kp, 3.6, 1e-9);
+  CHECK_NEAR(table.get(120, 12800).ki, 0.05, 1e-9);
+  CHECK_NEAR(table.get(180, 12800).kd, 22.0, 1e-9);
+  CHECK_NEAR(table.get(180, 11500).kp, 3.0, 1e-9);
+}
+
+void test_interpolation() {
+  // Halfway between rows
+  CHECK_NEAR(table.get(30, 11500).kp, (4.9 + 3.8) / 2, 1e-9);
+  // Halfway between columns
+  CHECK_NEAR(table.get(0, 11825).kp, (4.9 + 4.7) / 2, 1e-9);
+  // Middle of a cell is the average of its four corners
+  CHECK_NEAR(table.get(90, 12475).kp, (3.6 + 3.4 + 3.15 + 3.0) / 4, 1e-9);
+  // Only the magnitude's size matters
+  CHECK_NEAR(table.get(-45, 12000).kp, table.get(45, 12000).kp, 1e-12);
+}
+
+void test_clamping() {
+  CHECK_NEAR(table.get(400, 12150).kp, table.get(180, 12150).kp, 1e-12);
+  CHECK_NEAR(table.get(90, 9000).kp, table.get(90, 11500).kp, 1e-12);
+  CHECK_NEAR(table.get(90, 14000).kd, table.get(90, 12800).kd, 1e-12);
+}
+
+// Sweeps each axis in small steps, bigger steps than the table's slope allows would be a jump
+void test_continuity() {
+  const double step = 0.01;
+  double worst = 0;
+  for (double voltage = 11000; voltage <= 13300; voltage += 50) {
+    constants last = table.get(-10, voltage);
+    for (double magnitude = -10 + step; magnitude <= 200; magnitude += step) {
+      constants now = table.get(magnitude, voltage);
+      worst = std::fmax(worst, std::fabs(now.kp - last.kp) / step);
+      last = now;
+    }
+  }
+  // Steepest kp slope in the table is (4.9 - 3.8) / 60 deg
+  CHECK(worst <= 1.1 / 60 + 1e-6);
+
+  worst = 0;
+  for (double magnitude = 0; magnitude <= 180; magnitude += 5) {
+    constants last = table.get(magnitude, 11000);
+    for (double voltage = 11000 + 1; voltage <= 13300; voltage += 1) {
+      constants now = table.get(magnitude, voltage);
+      worst = std::fmax(worst, std::fabs(now.kp - last.kp));
+      last = now;
+    }
+  }
+  // Steepest kp slope across voltage is 0.2 per 650 mV
+  CHECK(worst <= 0.2 / 650 + 1e-9);
+}
+
+}  // namespace
+
+int main() {
+  test_breakpoints();
+  test_interpolation();
+  test_clamping();
+  test_continuity();
+  return host_test_result();
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+// Checks shared by the host tests in tools/*_test.cpp.  A failed check prints where it was and
+// keeps going, so one run shows every failure.  main() returns host_test_result().
+
+#include <cmath>
+#include <cstdio>
+
+inline int host_test_checks = 0;
+inline int host_test_failures = 0;
+
+#define CHECK(condition)                                                          \
+  do {                                                                            \
+    host_test_checks++;                                                           \
+    if (!(condition)) {                                                           \
+      host_test_failures++;                                                       \
+      fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+    }                                                                             \
+  } while (0)
+
+#define CHECK_NEAR(actual, expected, tolerance)                                                 \
+  do {                                                                                          \
+    host_test_checks++;                                                                         \
+    double a_ = (actual), e_ = (expected);                                                      \
+    if (!(std::fabs(a_ - e_) <= (tolerance))) {                                                 \
+      host_test_failures++;                                                                     \
+      fprintf(stderr, "%s:%d: %s is %g, expected %g\n", __FILE__, __LINE__, #actual, a_, e_); \
+    }                                                                                           \
+  } while (0)
+
+// Prints a summary and returns the exit code
+inline int host_test_result() {
+  printf("%d checks, %d failed\n", host_test_checks, host_test_failures);
+  return host_test_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+// JamDetector host test.
+//
+// Plays current and velocity traces of a conveyor stage through JamDetector: spinning up from
+// rest, balls going through, a real jam, a jam that won't clear, and stalls that are too short or
+// at too little power to count.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/jam_detector_test.cpp src/jam_detector.cpp -o jam_detector_test
+//   ./jam_detector_test
+
+#include <functional>
+#include <vector>
+
+#include "host_test.hpp"
+#include "jam_detector.hpp"
+
+namespace {
+
+const int DT = 10;  // ms, the subsystem task's period
+
+struct sample {
+  double velocity;  // rpm
+  double current;   // mA
+};
+
+// What the motor reports at a time, given what it was last told to do
+using trace = std::function<sample(int time, double output)>;
+
+// Runs a trace for some ms at a fixed command and returns every output
+std::vector<double> run(JamDetector& jam, double command, int duration, trace motor) {
+  std::vector<double> outputs;
+  double output = command;
+  for (int time = 0; time < duration; time += DT) {
+    sample s = motor(time, output);
+    output = jam.iterate(command, s.velocity, s.current, time);
+    outputs.push_back(output);
+  }
+  return outputs;
+}
+
+// Index of the first tick that isn't the command, -1 if there isn't one
+int first_change(const std::vector<double>& outputs, double command) {
+  for (size_t i = 0; i < outputs.size(); i++)
+    if (outputs[i] != command) return i;
+  return -1;
+}
+
+// Current surges for 120 ms while the belt gets going, which is shorter than the window
+void test_spin_up() {
+  JamDetector jam;
+  auto outputs = run(jam, 127, 1000, [](int time, double) {
+    return time < 120 ? sample{2.0, 2400} : sample{180, 700};
+  });
+  CHECK(first_change(outputs, 127) == -1);
+  CHECK(jam.jams_get() == 0);
+}
+
+// Balls going through pull current in bursts, but the belt keeps moving
+void test_balls_passing() {
+  JamDetector jam;
+  auto outputs = run(jam, 127, 2000, [](int time, double) {
+    bool ball = time % 300 < 80;
+    return sample{ball ? 120.0 : 180.0, ball ? 2200.0 : 700.0};
+  });
+  CHECK(first_change(outputs, 127) == -1);
+}
+
+// Jams at 500 ms and clears once it's backed off
+void test_jam_clears() {
+  JamDetector jam;
+  bool cleared = false;
+  auto outputs = run(jam, 100, 2000, [&](int time, double output) {
+    if (output < 0) cleared = true;
+    if (time < 500 || cleared) return sample{160, 800};
+    return sample{0.5, 2500};
+  });
+  // Stalled from 500 ms, counted after the window
+  int reversed = first_change(outputs, 100);
+  CHECK(reversed * DT == 500 + jam.constants.window);
+  CHECK(outputs[reversed] == -jam.constants.reverse_power);
+  CHECK(jam.jams_get() == 1);
+
+  // Backs off for reverse_time, then the command comes back
+  int reverse_ticks = 0;
+  for (size_t i = reversed; i < outputs.size() && outputs[i] < 0; i++) reverse_ticks++;
+  CHECK(reverse_ticks * DT == jam.constants.reverse_time);
+  CHECK(outputs.back() == 100);
+  CHECK(!jam.unjamming());
+}
+
+// Something wedged for good gets a reverse every window + reverse + recover
+void test_jam_stays() {
+  JamDetector jam;
+  run(jam, 127, 3000, [](int, double output) {
+    return output < 0 ? sample{-100, 900} : sample{0, 2600};
+  });
+  const JamDetector::Constants& c = jam.constants;
+  int cycle = c.window + c.reverse_time + c.recover_time;
+  CHECK(jam.jams_get() >= 3000 / cycle - 1);
+  CHECK(jam.jams_get() <= 3000 / cycle + 1);
+}
+
+// Running backwards, the unjam goes forwards
+void test_reverse_direction() {
+  JamDetector jam;
+  auto outputs = run(jam, -127, 400, [](int, double) { return sample{0, 2600}; });
+  int reversed = first_change(outputs, -127);
+  CHECK(reversed > 0);
+  CHECK(outputs[reversed] == jam.constants.reverse_power);
+}
+
+// Holding a ball against a stop at low power is on purpose
+void test_low_power() {
+  JamDetector jam;
+  auto outputs = run(jam, 20, 1000, [](int, double) { return sample{0, 2500}; });
+  CHECK(first_change(outputs, 20) == -1);
+}
+
+// A stall that lets go before the window is up starts the window again
+void test_window_restarts() {
+  JamDetector jam;
+  auto outputs = run(jam, 127, 1000, [&](int time, double) {
+    bool stalled = time % 200 < jam.constants.window - 20;
+    return stalled ? sample{0, 2500} : sample{150, 800};
+  });
+  CHECK(first_change(outputs, 127) == -1);
+}
+
+// Stopped but not straining, e.g. a motor that's unplugged
+void test_no_current() {
+  JamDetector jam;
+  auto outputs = run(jam, 127, 1000, [](int, double) { return sample{0, 0}; });
+  CHECK(first_change(outputs, 127) == -1);
+}
+
+}  // namespace
+
+int main() {
+  test_spin_up();
+  test_balls_passing();
+  test_jam_clears();
+  test_jam_stays();
+  test_reverse_direction();
+  test_low_power();
+  test_window_restarts();
+  test_no_current();
+  return host_test_result();
+}
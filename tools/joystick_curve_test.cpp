@@ -0,0 +1,79 @@
+// CurveTable host test and benchmark.
+//
+// Checks that every entry of the table matches joystick_curve() across the scales the curve
+// buttons can reach, then times table lookups against computing the curve every time.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/joystick_curve_test.cpp -o joystick_curve_test
+//   ./joystick_curve_test [lookups]
+
+#include <chrono>
+#include <cstdlib>
+
+#include "host_test.hpp"
+#include "joystick_curve.hpp"
+
+namespace {
+
+// The table is floats, so allow float rounding of values up to 127
+const double TOLERANCE = 127.0 * 1e-6;
+
+void test_matches_curve() {
+  CurveTable table;
+  for (int step = 0; step <= 200; step++) {
+    double scale = step * 0.1;
+    table.scale_set(scale);
+    CHECK(table.scale_get() == scale);
+    for (int x = -127; x <= 127; x++) CHECK_NEAR(table.get(x), joystick_curve(x, scale), TOLERANCE);
+  }
+}
+
+void test_shape() {
+  CurveTable table(4.0);
+  CHECK_NEAR(table.get(0), 0.0, TOLERANCE);
+  CHECK_NEAR(table.get(127), 127.0, TOLERANCE);  // Full stick is still full power
+  CHECK_NEAR(table.get(-127), -127.0, TOLERANCE);
+  for (int x = 1; x <= 127; x++) {
+    CHECK_NEAR(table.get(-x), -table.get(x), TOLERANCE);
+    CHECK(table.get(x) <= x + TOLERANCE);  // Curves only ever slow the middle of the stick down
+    CHECK(table.get(x) >= table.get(x - 1));
+  }
+
+  CurveTable linear;
+  for (int x = -127; x <= 127; x++) CHECK_NEAR(linear.get(x), x, TOLERANCE);
+}
+
+void test_clamping() {
+  CurveTable table(2.5);
+  CHECK_NEAR(table.get(500), table.get(127), 0);
+  CHECK_NEAR(table.get(-500), table.get(-128), 0);
+}
+
+// Times both ways over the same inputs.  sum keeps the compiler from dropping the work
+void benchmark(long lookups) {
+  using clock = std::chrono::steady_clock;
+  CurveTable table(3.7);
+  volatile double scale = 3.7;
+  double sum = 0;
+
+  auto start = clock::now();
+  for (long i = 0; i < lookups; i++) sum += table.get((int)(i % 255) - 127);
+  double table_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / lookups;
+
+  start = clock::now();
+  for (long i = 0; i < lookups; i++) sum += joystick_curve((int)(i % 255) - 127, scale);
+  double curve_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / lookups;
+
+  printf("%ld lookups: table %.2f ns, joystick_curve %.2f ns, %.1fx  (%g)\n", lookups, table_ns, curve_ns,
+         curve_ns / table_ns, sum);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  test_matches_curve();
+  test_shape();
+  test_clamping();
+  benchmark(argc > 1 ? atol(argv[1]) : 10000000);
+  return host_test_result();
+}
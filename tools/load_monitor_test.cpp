@@ -0,0 +1,173 @@
+// LoadMonitor host test.
+//
+// Feeds entry sensor counts, intake current and time through LoadMonitor and checks it finishes
+// for the right reason: enough balls or a full robot, a loader that's gone dry, or the timeout.
+// The capacity case runs a BallQueue alongside it the way match_loader() does.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/load_monitor_test.cpp src/load_monitor.cpp src/ball_queue.cpp -o load_monitor_test
+//   ./load_monitor_test
+
+#include <algorithm>
+#include <functional>
+
+#include "ball_queue.hpp"
+#include "host_test.hpp"
+#include "load_monitor.hpp"
+
+namespace {
+
+const int DT = 10;  // ms, match_loader()'s period
+
+const double CURRENT_FREE = 600;  // mA, the intake spinning with nothing in it
+const double CURRENT_GRAB = 2000;  // mA, the intake pulling a ball in
+
+struct tick {
+  int entered;
+  double current;
+  bool full;
+};
+
+// Runs until the monitor is done or the time runs out, returns the ms it finished at or -1
+int run(LoadMonitor& monitor, int start, int until, std::function<tick(int time)> robot) {
+  for (int now = start; now <= until; now += DT) {
+    tick t = robot(now - start);
+    if (monitor.iterate(t.entered, t.current, t.full, now)) return now - start;
+  }
+  return -1;
+}
+
+// A ball every interval ms starting at first, seen by the sensor and by a current bump
+int balls_by(int time, int first, int interval, int most) {
+  if (time < first) return 0;
+  return std::min(most, (time - first) / interval + 1);
+}
+
+// True for the 60 ms the intake takes to pull in each of those balls
+bool grabbing(int time, int first, int interval, int most) {
+  if (time < first || (time - first) / interval >= most) return false;
+  return (time - first) % interval < 60;
+}
+
+void test_filled() {
+  LoadMonitor monitor;
+  monitor.start(3, 3000, 1000);
+  int done = run(monitor, 1000, 5000, [](int time) {
+    return tick{balls_by(time, 200, 300, 10), grabbing(time, 200, 300, 10) ? CURRENT_GRAB : CURRENT_FREE, false};
+  });
+  CHECK(monitor.result_get() == LoadMonitor::FILLED);
+  CHECK(monitor.loaded_get() == 3);
+  CHECK(done == 200 + 2 * 300);  // Done on the tick the third ball comes in
+}
+
+// The loader runs out after two balls
+void test_dry() {
+  LoadMonitor monitor;
+  monitor.start(5, 5000, 0);
+  int done = run(monitor, 0, 6000, [](int time) {
+    return tick{balls_by(time, 200, 300, 2), grabbing(time, 200, 300, 2) ? CURRENT_GRAB : CURRENT_FREE, false};
+  });
+  CHECK(monitor.result_get() == LoadMonitor::DRY);
+  CHECK(monitor.loaded_get() == 2);
+  CHECK(done == 500 + monitor.constants.dry_time);  // dry_time after the last ball
+}
+
+// Balls keep trickling in, just not enough of them in time
+void test_timed_out() {
+  LoadMonitor monitor;
+  monitor.start(20, 2000, 0);
+  int done = run(monitor, 0, 5000, [](int time) {
+    return tick{balls_by(time, 100, 700, 20), grabbing(time, 100, 700, 20) ? CURRENT_GRAB : CURRENT_FREE, false};
+  });
+  CHECK(monitor.result_get() == LoadMonitor::TIMED_OUT);
+  CHECK(done == 2000);
+  CHECK(monitor.loaded_get() == 3);
+}
+
+// The sensor misses balls, the current bumps still count them
+void test_sensor_misses() {
+  LoadMonitor monitor;
+  monitor.start(4, 3000, 0);
+  run(monitor, 0, 3000, [](int time) {
+    return tick{balls_by(time, 200, 300, 10) / 2, grabbing(time, 200, 300, 10) ? CURRENT_GRAB : CURRENT_FREE, false};
+  });
+  CHECK(monitor.result_get() == LoadMonitor::FILLED);
+  CHECK(monitor.loaded_get() == 4);
+}
+
+// Current sitting between the thresholds after a grab doesn't count the same ball twice
+void test_current_hysteresis() {
+  LoadMonitor monitor;
+  monitor.start(5, 3000, 0);
+  const LoadMonitor::Constants& c = monitor.constants;
+  double between = (c.current_enter + c.current_exit) / 2;
+  double trace[] = {CURRENT_GRAB, between, CURRENT_GRAB, between, CURRENT_FREE, CURRENT_GRAB, CURRENT_FREE};
+  int now = 200;
+  for (double current : trace) {
+    monitor.iterate(0, current, false, now);
+    now += DT;
+  }
+  CHECK(monitor.loaded_get() == 2);
+}
+
+// The inrush when the intake starts isn't a ball
+void test_spin_up_ignored() {
+  LoadMonitor monitor;
+  monitor.start(3, 3000, 0);
+  run(monitor, 0, 400, [](int time) { return tick{0, time < 80 ? 2600.0 : CURRENT_FREE, false}; });
+  CHECK(monitor.loaded_get() == 0);
+  CHECK(monitor.result_get() == LoadMonitor::LOADING);
+}
+
+// A target past what the robot can hold ends as FILLED when it's full, not DRY after the intake
+// stops.  BallQueue stands in for the robot, and holds the intake once it's full like INTAKE does
+void test_capacity() {
+  BallQueue queue;
+  LoadMonitor monitor;
+  monitor.start(queue.constants.capacity + 1, 3000, 0);
+  int entered = 0;
+  int done = -1;
+  for (int now = 0; now <= 3000 && done < 0; now += DT) {
+    bool running = !queue.full();
+    bool arrives = running && now >= 200 && (now - 200) % 300 == 0;
+    if (arrives) {
+      queue.enter();
+      entered++;
+    }
+    queue.advance(running ? 1.0 : 0.0, 0.0, false);
+    double current = arrives ? CURRENT_GRAB : CURRENT_FREE;
+    if (monitor.iterate(entered, current, queue.full(), now)) done = now;
+  }
+  CHECK(monitor.result_get() == LoadMonitor::FILLED);
+  CHECK(monitor.loaded_get() == queue.constants.capacity);
+  CHECK(done == 200 + (queue.constants.capacity - 1) * 300);
+}
+
+// Once it's done it stays done, and start() begins again
+void test_restart() {
+  LoadMonitor monitor;
+  monitor.start(1, 1000, 0);
+  CHECK(monitor.iterate(1, CURRENT_FREE, false, 150));
+  CHECK(monitor.iterate(0, CURRENT_FREE, false, 160));
+  CHECK(monitor.result_get() == LoadMonitor::FILLED);
+
+  monitor.start(2, 1000, 5000);
+  CHECK(monitor.result_get() == LoadMonitor::LOADING);
+  CHECK(monitor.loaded_get() == 0);
+  CHECK(!monitor.iterate(1, CURRENT_FREE, false, 5200));
+  CHECK(monitor.loaded_get() == 1);
+}
+
+}  // namespace
+
+int main() {
+  test_filled();
+  test_dry();
+  test_timed_out();
+  test_sensor_misses();
+  test_current_hysteresis();
+  test_spin_up_ignored();
+  test_capacity();
+  test_restart();
+  return host_test_result();
+}
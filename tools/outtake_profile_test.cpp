@@ -0,0 +1,93 @@
+// OuttakeProfile host test.
+//
+// Drives a simulated robot at a goal while an outtake that spins up at a fixed acceleration waits
+// for should_start().  The outtake has to be at speed when the robot arrives, without starting
+// much earlier than it needs to.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/outtake_profile_test.cpp src/outtake_profile.cpp -o outtake_profile_test
+//   ./outtake_profile_test
+
+#include <algorithm>
+
+#include "host_test.hpp"
+#include "outtake_profile.hpp"
+
+namespace {
+
+const double DT = 0.01;  // s, the subsystem task's period
+
+struct approach_result {
+  double start_distance;  // in from the goal when spinning up started, -1 if it never did
+  double lead;            // s between reaching speed and arriving, negative if it was late
+};
+
+// Robot closes on the goal at a fixed speed, the outtake accelerates once spinning up starts
+approach_result approach(const OuttakeProfile& profile, double target, double distance, double speed) {
+  approach_result result = {-1, 0};
+  double rpm = 0;
+  double at_speed_time = -1;
+  double time = 0;
+  bool started = false;
+  while (distance > 0) {
+    if (!started && profile.should_start(target, rpm, distance, speed)) {
+      started = true;
+      result.start_distance = distance;
+    }
+    if (started) rpm = std::min(target, rpm + profile.constants.acceleration * DT);
+    if (rpm >= target && at_speed_time < 0) at_speed_time = time;
+    distance -= speed * DT;
+    time += DT;
+  }
+  result.lead = at_speed_time < 0 ? -1 : time - at_speed_time;
+  return result;
+}
+
+void test_spin_up_time() {
+  OuttakeProfile profile;
+  CHECK_NEAR(profile.spin_up_time(175, 0), 0.175, 1e-12);
+  CHECK_NEAR(profile.spin_up_time(95, 175), 0.08, 1e-12);
+}
+
+// Arrives at speed and starts within a couple of ticks of the latest it could.  Slow approaches
+// start at arrive_distance no matter what, so they can be at speed early
+void test_timing() {
+  OuttakeProfile profile;
+  const double speeds[] = {10, 25, 40, 60};
+  const double targets[] = {95, 175};
+  for (double speed : speeds) {
+    for (double target : targets) {
+      approach_result result = approach(profile, target, 48, speed);
+      CHECK(result.start_distance > 0);
+      CHECK(result.lead >= 0);
+      double arrive_lead = profile.constants.arrive_distance / speed - profile.spin_up_time(target, 0);
+      CHECK(result.lead <= std::max(profile.constants.margin, arrive_lead) + 3 * DT);
+    }
+  }
+}
+
+// A robot that isn't getting closer doesn't spin up until it's at the goal
+void test_stopped() {
+  OuttakeProfile profile;
+  CHECK(!profile.should_start(175, 0, 24, 0));
+  CHECK(!profile.should_start(175, 0, 24, -10));
+  CHECK(profile.should_start(175, 0, profile.constants.arrive_distance, 0));
+}
+
+// Already spinning means less time is needed, so it starts closer
+void test_already_spinning() {
+  OuttakeProfile profile;
+  CHECK(profile.should_start(175, 0, 8, 40));
+  CHECK(!profile.should_start(175, 150, 8, 40));
+  CHECK(profile.should_start(175, 175, 4, 40));
+}
+
+}  // namespace
+
+int main() {
+  test_spin_up_time();
+  test_timing();
+  test_stopped();
+  test_already_spinning();
+  return host_test_result();
+}
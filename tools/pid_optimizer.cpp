@@ -0,0 +1,594 @@
+// Offline PID / constant optimizer.
+//
+// Simulates the drivetrain from main.cpp running EZ-Template style PID loops and searches
+// (Nelder-Mead, multi-start) over the gains and slew constants set in default_constants() to
+// minimize time-to-settle plus overshoot across a suite of motions.  Exit times are simulated but
+// held at their defaults, a shorter settle window always exits sooner so the search would only
+// run them down to their lower bound.  Restarts run in parallel across all cores.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -pthread tools/pid_optimizer.cpp -o pid_optimizer
+//   ./pid_optimizer [restarts] [iterations]
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/////
+// Robot model
+/////
+
+// Matches the chassis constructor in main.cpp
+const double WHEEL_DIAMETER = 4.125;  // in
+const double WHEEL_RPM = 343.0;
+const double TRACK_WIDTH = 12.5;  // in
+const double MAX_SPEED = WHEEL_RPM * M_PI * WHEEL_DIAMETER / 60.0;  // in/s at 127
+const double MOTOR_TAU = 0.12;                                       // s, first order wheel response
+const double DT = 0.01;                                              // s, ez::util::DELAY_TIME
+const double TIMEOUT = 4.0;                                          // s, a motion that hasn't exited is a failure
+
+// Speeds from autons.cpp
+const int DRIVE_SPEED = 110;
+const int TURN_SPEED = 90;
+const int SWING_SPEED = 110;
+
+struct State {
+  double x = 0, y = 0, theta = 0;  // in, in, deg (0 is +y, clockwise positive like EZ-Template)
+  double vl = 0, vr = 0;           // in/s
+  double left = 0, right = 0;      // wheel travel, in
+};
+
+void step(State& s, double cmd_l, double cmd_r) {
+  cmd_l = std::clamp(cmd_l, -127.0, 127.0);
+  cmd_r = std::clamp(cmd_r, -127.0, 127.0);
+  s.vl += (cmd_l / 127.0 * MAX_SPEED - s.vl) * DT / MOTOR_TAU;
+  s.vr += (cmd_r / 127.0 * MAX_SPEED - s.vr) * DT / MOTOR_TAU;
+  double v = (s.vl + s.vr) / 2.0;
+  double w = (s.vl - s.vr) / TRACK_WIDTH;  // rad/s, clockwise positive
+  double mid = s.theta * M_PI / 180.0 + w * DT / 2.0;
+  s.x += v * DT * std::sin(mid);
+  s.y += v * DT * std::cos(mid);
+  s.theta += w * DT * 180.0 / M_PI;
+  s.left += s.vl * DT;
+  s.right += s.vr * DT;
+}
+
+double wrap_angle(double t) {
+  while (t > 180) t -= 360;
+  while (t < -180) t += 360;
+  return t;
+}
+
+/////
+// EZ-Template style PID, slew and exit conditions
+/////
+
+struct Constants {
+  double kp = 0, ki = 0, kd = 0, start_i = 0;
+};
+
+struct PID {
+  Constants c;
+  double integral = 0, prev_error = 0, prev_current = 0;
+  bool first = true;
+
+  explicit PID(Constants k) : c(k) {}
+
+  // Derivative on measurement, i only within start_i and reset on sign change
+  double compute_error(double error, double current) {
+    double derivative = first ? 0.0 : current - prev_current;
+    first = false;
+    if (c.ki != 0) {
+      if (std::fabs(error) < c.start_i) integral += error;
+      if ((error > 0) != (prev_error > 0)) integral = 0;
+    }
+    prev_error = error;
+    prev_current = current;
+    return error * c.kp + integral * c.ki - derivative * c.kd;
+  }
+};
+
+struct Slew {
+  double distance = 0, min_speed = 0;
+
+  double iterate(double traveled, double max_speed) const {
+    if (distance <= 0 || traveled >= distance) return max_speed;
+    double out = min_speed + (max_speed - min_speed) * (traveled / distance);
+    return std::min(out, max_speed);
+  }
+};
+
+struct Exit {
+  double small_time = 0, small_error = 0, big_time = 0, big_error = 0, velocity_time = 0;
+};
+
+struct ExitTracker {
+  Exit e;
+  double small_t = 0, big_t = 0, vel_t = 0;
+
+  // Returns true once any exit condition trips
+  bool iterate(double error, double velocity) {
+    error = std::fabs(error);
+    small_t = error < e.small_error ? small_t + DT * 1000 : 0;
+    big_t = error < e.big_error ? big_t + DT * 1000 : 0;
+    vel_t = std::fabs(velocity) < 0.05 ? vel_t + DT * 1000 : 0;
+    return (e.small_error > 0 && small_t >= e.small_time) || (e.big_error > 0 && big_t >= e.big_time) || (e.velocity_time > 0 && vel_t >= e.velocity_time);
+  }
+};
+
+/////
+// Tunable parameters, seeded from default_constants()
+/////
+
+struct Param {
+  const char* name;
+  double value, lo, hi;
+};
+
+enum : int {
+  DRIVE_P, DRIVE_D, HEADING_P, HEADING_D,
+  TURN_P, TURN_I, TURN_D, TURN_START_I,
+  SWING_P, SWING_D,
+  ODOM_A_P, ODOM_A_D, BOOM_P, BOOM_D,
+  SLEW_DRIVE_MIN, SLEW_TURN_MIN, SLEW_SWING_MIN,
+  TURN_EXIT_SMALL_T, SWING_EXIT_SMALL_T, DRIVE_EXIT_SMALL_T, ODOM_EXIT_SMALL_T,
+  PARAM_COUNT
+};
+
+std::vector<Param> default_params() {
+  return {
+      {"drive kp", 20.0, 1.0, 40.0},
+      {"drive kd", 100.0, 0.0, 300.0},
+      {"heading kp", 11.0, 0.0, 30.0},
+      {"heading kd", 20.0, 0.0, 100.0},
+      {"turn kp", 3.0, 0.5, 10.0},
+      {"turn ki", 0.05, 0.0, 0.3},
+      {"turn kd", 20.0, 0.0, 80.0},
+      {"turn start_i", 15.0, 0.0, 30.0},
+      {"swing kp", 6.0, 0.5, 15.0},
+      {"swing kd", 65.0, 0.0, 150.0},
+      {"odom angular kp", 6.5, 0.5, 15.0},
+      {"odom angular kd", 52.5, 0.0, 150.0},
+      {"boomerang kp", 5.8, 0.5, 15.0},
+      {"boomerang kd", 32.5, 0.0, 150.0},
+      {"slew drive min", 70.0, 20.0, 127.0},
+      {"slew turn min", 70.0, 20.0, 127.0},
+      {"slew swing min", 80.0, 20.0, 127.0},
+      {"turn exit small time", 90.0, 30.0, 300.0},  // Exit times aren't in any group, so never searched
+      {"swing exit small time", 90.0, 30.0, 300.0},
+      {"drive exit small time", 90.0, 30.0, 300.0},
+      {"odom exit small time", 90.0, 30.0, 300.0},
+  };
+}
+
+using Vec = std::vector<double>;
+
+/////
+// Motions
+/////
+
+struct Result {
+  double settle = TIMEOUT;  // s
+  double overshoot = 0;     // motion units past the target
+  double final_error = 0;   // motion units at exit
+  bool exited = false;
+};
+
+Result sim_turn(const Vec& p, double target) {
+  State s;
+  PID pid({p[TURN_P], p[TURN_I], p[TURN_D], p[TURN_START_I]});
+  Slew slew{3.0, p[SLEW_TURN_MIN]};
+  ExitTracker ex{{p[TURN_EXIT_SMALL_T], 3, 250, 7, 500}};
+  Result r;
+  for (double t = 0; t < TIMEOUT; t += DT) {
+    double error = target - s.theta;
+    double speed = slew.iterate(std::fabs(s.theta), TURN_SPEED);
+    double out = std::clamp(pid.compute_error(error, s.theta), -speed, speed);
+    step(s, out, -out);
+    r.overshoot = std::max(r.overshoot, (s.theta - target) * (target > 0 ? 1 : -1));
+    if (ex.iterate(target - s.theta, (s.vl - s.vr) / 2.0)) {
+      r.settle = t;
+      r.exited = true;
+      break;
+    }
+  }
+  r.final_error = std::fabs(target - s.theta);
+  return r;
+}
+
+Result sim_drive(const Vec& p, double target) {
+  State s;
+  PID drive({p[DRIVE_P], 0, p[DRIVE_D], 0});
+  PID heading({p[HEADING_P], 0, p[HEADING_D], 0});
+  Slew slew{3.0, p[SLEW_DRIVE_MIN]};
+  ExitTracker ex{{p[DRIVE_EXIT_SMALL_T], 1, 250, 3, 500}};
+  Result r;
+  for (double t = 0; t < TIMEOUT; t += DT) {
+    double traveled = (s.left + s.right) / 2.0;
+    double speed = slew.iterate(std::fabs(traveled), DRIVE_SPEED);
+    double out = std::clamp(drive.compute_error(target - traveled, traveled), -speed, speed);
+    double h = heading.compute_error(-s.theta, s.theta);
+    step(s, out + h, out - h);
+    traveled = (s.left + s.right) / 2.0;
+    r.overshoot = std::max(r.overshoot, (traveled - target) * (target > 0 ? 1 : -1));
+    if (ex.iterate(target - traveled, (s.vl + s.vr) / 2.0)) {
+      r.settle = t;
+      r.exited = true;
+      break;
+    }
+  }
+  r.final_error = std::fabs(target - (s.left + s.right) / 2.0);
+  return r;
+}
+
+Result sim_swing(const Vec& p, double target) {
+  State s;
+  PID pid({p[SWING_P], 0, p[SWING_D], 0});
+  Slew slew{3.0, p[SLEW_SWING_MIN]};
+  ExitTracker ex{{p[SWING_EXIT_SMALL_T], 3, 250, 7, 500}};
+  Result r;
+  for (double t = 0; t < TIMEOUT; t += DT) {
+    double speed = slew.iterate(std::fabs(s.left), SWING_SPEED);
+    double out = std::clamp(pid.compute_error(target - s.theta, s.theta), -speed, speed);
+    step(s, out, 0);  // ez::LEFT_SWING with no opposite speed
+    r.overshoot = std::max(r.overshoot, (s.theta - target) * (target > 0 ? 1 : -1));
+    if (ex.iterate(target - s.theta, s.vl)) {
+      r.settle = t;
+      r.exited = true;
+      break;
+    }
+  }
+  r.final_error = std::fabs(target - s.theta);
+  return r;
+}
+
+struct Point {
+  double x, y;
+};
+
+// Shared odom step: xy PID along the heading while angular PID faces `face`, with turn bias like odom_turn_bias_set(0.9)
+void odom_step(State& s, PID& xy, PID& angular, double distance_left, double face, double max_speed) {
+  double angle_error = wrap_angle(face - s.theta);
+  double xy_error = distance_left * std::cos(angle_error * M_PI / 180.0);
+  double xy_out = std::clamp(xy.compute_error(xy_error, -distance_left), -max_speed, max_speed);
+  double a_out = angular.compute_error(angle_error, s.theta);
+  const double bias = 0.9;
+  if (std::fabs(xy_out) + std::fabs(a_out) > max_speed) xy_out *= std::max(0.0, (max_speed - std::fabs(a_out) * bias) / std::fabs(xy_out));
+  step(s, xy_out + a_out, xy_out - a_out);
+}
+
+double angle_to(const State& s, Point p) { return std::atan2(p.x - s.x, p.y - s.y) * 180.0 / M_PI; }
+double distance_to(const State& s, Point p) { return std::hypot(p.x - s.x, p.y - s.y); }
+
+// odom_boomerang_example: go to (0, 24, 45)
+Result sim_boomerang(const Vec& p) {
+  State s;
+  PID xy({p[DRIVE_P], 0, p[DRIVE_D], 0});
+  PID angular({p[BOOM_P], 0, p[BOOM_D], 0});
+  ExitTracker ex{{p[ODOM_EXIT_SMALL_T], 1, 250, 3, 500}};
+  const Point target{0, 24};
+  const double target_theta = 45, dlead = 0.625, max_carrot = 16;
+  Result r;
+  for (double t = 0; t < TIMEOUT; t += DT) {
+    double h = std::min(distance_to(s, target) * dlead, max_carrot);
+    Point carrot{target.x - h * std::sin(target_theta * M_PI / 180.0), target.y - h * std::cos(target_theta * M_PI / 180.0)};
+    double d = distance_to(s, target);
+    double face = d < 6 ? target_theta : angle_to(s, carrot);
+    odom_step(s, xy, angular, d, face, DRIVE_SPEED);
+    r.overshoot = std::max(r.overshoot, s.y - target.y);
+    if (ex.iterate(distance_to(s, target), (s.vl + s.vr) / 2.0)) {
+      r.settle = t;
+      r.exited = true;
+      break;
+    }
+  }
+  r.final_error = distance_to(s, target);
+  return r;
+}
+
+// odom_pure_pursuit_example: pass through (6, 10) and (0, 20) on the way to (0, 30)
+Result sim_pure_pursuit(const Vec& p) {
+  State s;
+  PID xy({p[DRIVE_P], 0, p[DRIVE_D], 0});
+  PID angular({p[ODOM_A_P], 0, p[ODOM_A_D], 0});
+  ExitTracker ex{{p[ODOM_EXIT_SMALL_T], 1, 250, 3, 500}};
+  Slew slew{3.0, p[SLEW_DRIVE_MIN]};
+  const double look_ahead = 7.0, spacing = 0.5;
+
+  // Inject points like EZ-Template does before following
+  std::vector<Point> corners = {{0, 0}, {6, 10}, {0, 20}, {0, 30}};
+  std::vector<Point> path;
+  for (size_t i = 0; i + 1 < corners.size(); i++) {
+    Point a = corners[i], b = corners[i + 1];
+    int n = std::max(1, (int)(std::hypot(b.x - a.x, b.y - a.y) / spacing));
+    for (int j = 0; j < n; j++) path.push_back({a.x + (b.x - a.x) * j / n, a.y + (b.y - a.y) * j / n});
+  }
+  path.push_back(corners.back());
+  const Point target = path.back();
+
+  size_t index = 0;
+  Result r;
+  for (double t = 0; t < TIMEOUT; t += DT) {
+    while (index + 1 < path.size() && distance_to(s, path[index]) < look_ahead) index++;
+    Point aim = path[index];
+    double d = distance_to(s, target);
+    double face = d < 3 ? s.theta : angle_to(s, aim);
+    double cap = slew.iterate((s.left + s.right) / 2.0, DRIVE_SPEED);
+    odom_step(s, xy, angular, index + 1 == path.size() ? d : d + look_ahead, face, cap);
+    r.overshoot = std::max(r.overshoot, s.y - target.y);
+    if (index + 1 == path.size() && ex.iterate(d, (s.vl + s.vr) / 2.0)) {
+      r.settle = t;
+      r.exited = true;
+      break;
+    }
+  }
+  r.final_error = distance_to(s, target);
+  return r;
+}
+
+struct Motion {
+  const char* name;
+  Result (*run)(const Vec&);
+  double overshoot_scale;  // converts motion units into the cost's seconds
+  std::vector<int> params;  // every searched parameter the motion depends on
+};
+
+const std::vector<Motion>& motions() {
+  static const std::vector<Motion> list = {
+      {"turn 90 deg", [](const Vec& p) { return sim_turn(p, 90); }, 0.05, {TURN_P, TURN_I, TURN_D, TURN_START_I, SLEW_TURN_MIN}},
+      {"turn 180 deg", [](const Vec& p) { return sim_turn(p, 180); }, 0.05, {TURN_P, TURN_I, TURN_D, TURN_START_I, SLEW_TURN_MIN}},
+      {"drive 24 in", [](const Vec& p) { return sim_drive(p, 24); }, 0.15, {DRIVE_P, DRIVE_D, HEADING_P, HEADING_D, SLEW_DRIVE_MIN}},
+      {"drive 48 in", [](const Vec& p) { return sim_drive(p, 48); }, 0.15, {DRIVE_P, DRIVE_D, HEADING_P, HEADING_D, SLEW_DRIVE_MIN}},
+      {"swing 45 deg", [](const Vec& p) { return sim_swing(p, 45); }, 0.05, {SWING_P, SWING_D, SLEW_SWING_MIN}},
+      {"boomerang", [](const Vec& p) { return sim_boomerang(p); }, 0.15, {DRIVE_P, DRIVE_D, BOOM_P, BOOM_D}},
+      {"pure pursuit", [](const Vec& p) { return sim_pure_pursuit(p); }, 0.15, {DRIVE_P, DRIVE_D, SLEW_DRIVE_MIN, ODOM_A_P, ODOM_A_D}},
+  };
+  return list;
+}
+
+double motion_cost(const Motion& m, const Vec& p) {
+  Result r = m.run(p);
+  double cost = r.settle + m.overshoot_scale * r.overshoot + m.overshoot_scale * 2.0 * r.final_error;
+  if (!r.exited) cost += TIMEOUT;
+  return cost;
+}
+
+// Cost of every motion, which is what the merged parameters are judged on
+double total_cost(const Vec& p) {
+  double cost = 0;
+  for (const auto& m : motions()) cost += motion_cost(m, p);
+  return cost;
+}
+
+/////
+// Search
+/////
+
+// Groups are tuned independently since each motion only depends on a subset of parameters.  The
+// drive gains are also used by the odom motions, so the drive group is scored on those too, and
+// the groups are only trusted together once total_cost() has checked the merged set
+struct Group {
+  const char* name;
+  std::vector<int> params;
+};
+
+const std::vector<Group> groups = {
+    {"turn", {TURN_P, TURN_I, TURN_D, TURN_START_I, SLEW_TURN_MIN}},
+    {"drive", {DRIVE_P, DRIVE_D, HEADING_P, HEADING_D, SLEW_DRIVE_MIN}},
+    {"swing", {SWING_P, SWING_D, SLEW_SWING_MIN}},
+    {"odom", {ODOM_A_P, ODOM_A_D, BOOM_P, BOOM_D}},
+};
+
+double group_cost(const Group& g, const Vec& full) {
+  double cost = 0;
+  for (const auto& m : motions()) {
+    bool uses = false;
+    for (int i : m.params)
+      if (std::find(g.params.begin(), g.params.end(), i) != g.params.end()) uses = true;
+    if (uses) cost += motion_cost(m, full);
+  }
+  return cost;
+}
+
+// Nelder-Mead over the group's parameters, clamped to each parameter's bounds
+Vec nelder_mead(const Group& g, const std::vector<Param>& params, Vec start, int iterations, double& best_cost) {
+  const size_t n = g.params.size();
+  auto expand = [&](const Vec& sub) {
+    Vec full = start;
+    for (size_t i = 0; i < n; i++) {
+      const Param& pr = params[g.params[i]];
+      full[g.params[i]] = std::clamp(sub[i], pr.lo, pr.hi);
+    }
+    return full;
+  };
+  auto f = [&](const Vec& sub) { return group_cost(g, expand(sub)); };
+
+  std::vector<Vec> simplex(n + 1, Vec(n));
+  for (size_t i = 0; i < n; i++) simplex[0][i] = start[g.params[i]];
+  for (size_t k = 1; k <= n; k++) {
+    simplex[k] = simplex[0];
+    const Param& pr = params[g.params[k - 1]];
+    simplex[k][k - 1] += (pr.hi - pr.lo) * 0.1;
+  }
+  std::vector<double> cost(n + 1);
+  for (size_t k = 0; k <= n; k++) cost[k] = f(simplex[k]);
+
+  for (int it = 0; it < iterations; it++) {
+    std::vector<size_t> order(n + 1);
+    for (size_t k = 0; k <= n; k++) order[k] = k;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return cost[a] < cost[b]; });
+    size_t best = order[0], worst = order[n], second = order[n - 1];
+
+    Vec centroid(n, 0.0);
+    for (size_t k = 0; k <= n; k++)
+      if (k != worst)
+        for (size_t i = 0; i < n; i++) centroid[i] += simplex[k][i] / n;
+
+    auto along = [&](double t) {
+      Vec v(n);
+      for (size_t i = 0; i < n; i++) v[i] = centroid[i] + t * (simplex[worst][i] - centroid[i]);
+      return v;
+    };
+
+    Vec reflected = along(-1.0);
+    double fr = f(reflected);
+    if (fr < cost[best]) {
+      Vec expanded = along(-2.0);
+      double fe = f(expanded);
+      if (fe < fr) {
+        simplex[worst] = expanded, cost[worst] = fe;
+      } else {
+        simplex[worst] = reflected, cost[worst] = fr;
+      }
+    } else if (fr < cost[second]) {
+      simplex[worst] = reflected, cost[worst] = fr;
+    } else {
+      Vec contracted = along(0.5);
+      double fc = f(contracted);
+      if (fc < cost[worst]) {
+        simplex[worst] = contracted, cost[worst] = fc;
+      } else {
+        // Shrink towards the best vertex
+        for (size_t k = 0; k <= n; k++) {
+          if (k == best) continue;
+          for (size_t i = 0; i < n; i++) simplex[k][i] = simplex[best][i] + 0.5 * (simplex[k][i] - simplex[best][i]);
+          cost[k] = f(simplex[k]);
+        }
+      }
+    }
+  }
+
+  size_t best = std::min_element(cost.begin(), cost.end()) - cost.begin();
+  best_cost = cost[best];
+  return expand(simplex[best]);
+}
+
+void print_report(const char* title, const Vec& p) {
+  printf("%s\n", title);
+  printf("  %-14s %9s %11s %11s %7s\n", "motion", "settle(s)", "overshoot", "final err", "cost");
+  for (const auto& m : motions()) {
+    Result r = m.run(p);
+    printf("  %-14s %9.2f %11.2f %11.2f %7.3f%s\n", m.name, r.settle, r.overshoot, r.final_error, motion_cost(m, p),
+           r.exited ? "" : "  (timed out)");
+  }
+  printf("  %-14s %41.3f\n", "total", total_cost(p));
+}
+
+void print_default_constants(const Vec& p) {
+  printf("void default_constants() {\n");
+  printf("  // P, I, D, and Start I\n");
+  printf("  chassis.pid_drive_constants_set(%.2f, 0.0, %.2f);\n", p[DRIVE_P], p[DRIVE_D]);
+  printf("  chassis.pid_heading_constants_set(%.2f, 0.0, %.2f);\n", p[HEADING_P], p[HEADING_D]);
+  printf("  chassis.pid_turn_constants_set(%.2f, %.3f, %.2f, %.1f);\n", p[TURN_P], p[TURN_I], p[TURN_D], p[TURN_START_I]);
+  printf("  chassis.pid_swing_constants_set(%.2f, 0.0, %.2f);\n", p[SWING_P], p[SWING_D]);
+  printf("  chassis.pid_odom_angular_constants_set(%.2f, 0.0, %.2f);\n", p[ODOM_A_P], p[ODOM_A_D]);
+  printf("  chassis.pid_odom_boomerang_constants_set(%.2f, 0.0, %.2f);\n", p[BOOM_P], p[BOOM_D]);
+  printf("\n  // Exit conditions\n");
+  printf("  chassis.pid_turn_exit_condition_set(%d_ms, 3_deg, 250_ms, 7_deg, 500_ms, 500_ms);\n", (int)std::lround(p[TURN_EXIT_SMALL_T]));
+  printf("  chassis.pid_swing_exit_condition_set(%d_ms, 3_deg, 250_ms, 7_deg, 500_ms, 500_ms);\n", (int)std::lround(p[SWING_EXIT_SMALL_T]));
+  printf("  chassis.pid_drive_exit_condition_set(%d_ms, 1_in, 250_ms, 3_in, 500_ms, 500_ms);\n", (int)std::lround(p[DRIVE_EXIT_SMALL_T]));
+  printf("  chassis.pid_odom_turn_exit_condition_set(%d_ms, 3_deg, 250_ms, 7_deg, 500_ms, 750_ms);\n", (int)std::lround(p[ODOM_EXIT_SMALL_T]));
+  printf("  chassis.pid_odom_drive_exit_condition_set(%d_ms, 1_in, 250_ms, 3_in, 500_ms, 750_ms);\n", (int)std::lround(p[ODOM_EXIT_SMALL_T]));
+  printf("  chassis.pid_turn_chain_constant_set(3_deg);\n");
+  printf("  chassis.pid_swing_chain_constant_set(5_deg);\n");
+  printf("  chassis.pid_drive_chain_constant_set(3_in);\n");
+  printf("\n  // Slew constants\n");
+  printf("  chassis.slew_turn_constants_set(3_deg, %d);\n", (int)std::lround(p[SLEW_TURN_MIN]));
+  printf("  chassis.slew_drive_constants_set(3_in, %d);\n", (int)std::lround(p[SLEW_DRIVE_MIN]));
+  printf("  chassis.slew_swing_constants_set(3_in, %d);\n", (int)std::lround(p[SLEW_SWING_MIN]));
+  printf("\n  // The amount that turns are prioritized over driving in odom motions\n");
+  printf("  // - if you have tracking wheels, you can run this higher.  1.0 is the max\n");
+  printf("  chassis.odom_turn_bias_set(0.9);\n\n");
+  printf("  chassis.odom_look_ahead_set(7_in);           // This is how far ahead in the path the robot looks at\n");
+  printf("  chassis.odom_boomerang_distance_set(16_in);  // This sets the maximum distance away from target that the carrot point can be\n");
+  printf("  chassis.odom_boomerang_dlead_set(0.625);     // This handles how aggressive the end of boomerang motions are\n\n");
+  printf("  chassis.pid_angle_behavior_set(ez::shortest);  // Changes the default behavior for turning, this defaults it to the shortest path there\n");
+  printf("}\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int restarts = argc > 1 ? std::atoi(argv[1]) : 8;
+  int iterations = argc > 2 ? std::atoi(argv[2]) : 150;
+
+  std::vector<Param> params = default_params();
+  Vec start(PARAM_COUNT);
+  for (int i = 0; i < PARAM_COUNT; i++) start[i] = params[i].value;
+
+  // One job per (group, restart).  The first restart of every group starts from default_constants()
+  struct Job {
+    size_t group;
+    int restart;
+    Vec best;
+    double cost;
+  };
+  std::vector<Job> jobs;
+  for (size_t g = 0; g < groups.size(); g++)
+    for (int r = 0; r < restarts; r++) jobs.push_back({g, r, {}, 0.0});
+
+  std::atomic<size_t> next{0};
+  std::mutex print_mutex;
+  auto worker = [&]() {
+    for (size_t j = next++; j < jobs.size(); j = next++) {
+      Job& job = jobs[j];
+      const Group& g = groups[job.group];
+      Vec seed = start;
+      if (job.restart > 0) {
+        std::mt19937 rng(1234 + j);
+        for (int i : g.params) {
+          std::uniform_real_distribution<double> dist(params[i].lo, params[i].hi);
+          seed[i] = 0.5 * seed[i] + 0.5 * dist(rng);
+        }
+      }
+      job.best = nelder_mead(g, params, seed, iterations, job.cost);
+      std::lock_guard<std::mutex> lock(print_mutex);
+      fprintf(stderr, "  %s restart %d: cost %.3f\n", g.name, job.restart, job.cost);
+    }
+  };
+
+  unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  fprintf(stderr, "Optimizing %zu groups x %d restarts on %u threads...\n", groups.size(), restarts, threads);
+  std::vector<std::thread> pool;
+  for (unsigned i = 0; i < threads; i++) pool.emplace_back(worker);
+  for (auto& t : pool) t.join();
+
+  // Merge the best result of every group into one parameter set.  Groups share motions, so a
+  // group's result is only kept if every motion together still costs less with it
+  Vec tuned = start;
+  double tuned_cost = total_cost(start);
+  for (size_t g = 0; g < groups.size(); g++) {
+    const Job* best = nullptr;
+    for (const auto& job : jobs)
+      if (job.group == g && (best == nullptr || job.cost < best->cost)) best = &job;
+    if (best == nullptr) continue;
+    Vec merged = tuned;
+    for (int i : groups[g].params) merged[i] = best->best[i];
+    double merged_cost = total_cost(merged);
+    if (merged_cost < tuned_cost) {
+      tuned = merged;
+      tuned_cost = merged_cost;
+    } else {
+      fprintf(stderr, "  %s: best result makes the merged set worse, kept the defaults\n", groups[g].name);
+    }
+  }
+
+  print_report("Report: default_constants()", start);
+  print_report("Report: tuned", tuned);
+  printf("\nTotal cost of every motion: %.3f -> %.3f\n", total_cost(start), tuned_cost);
+  printf("\nChanged parameters:\n");
+  for (int i = 0; i < PARAM_COUNT; i++)
+    if (std::fabs(tuned[i] - start[i]) > 1e-9) printf("  %-22s %8.3f -> %8.3f\n", params[i].name, start[i], tuned[i]);
+  printf("\n");
+  print_default_constants(tuned);
+  return 0;
+}
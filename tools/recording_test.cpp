@@ -0,0 +1,130 @@
+// Recording format host test.
+//
+// Encodes a driver control session with RecordingEncoder and checks RecordingDecoder plays back
+// the same frame on every tick, including when playback skips ticks or the buffer fills up.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/recording_test.cpp src/recording_format.cpp -o recording_test
+//   ./recording_test
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "host_test.hpp"
+#include "recording_format.hpp"
+
+namespace {
+
+bool frames_equal(const controller_frame& a, const controller_frame& b) {
+  return memcmp(a.axes, b.axes, sizeof(a.axes)) == 0 && a.buttons == b.buttons && a.state == b.state;
+}
+
+// Sticks that wander, buttons that toggle now and then, and stretches of nothing changing
+std::vector<controller_frame> session(int ticks, unsigned seed) {
+  std::mt19937 random(seed);
+  std::vector<controller_frame> frames(ticks);
+  controller_frame frame;
+  for (int tick = 0; tick < ticks; tick++) {
+    int roll = random() % 10;
+    if (roll < 5) {
+      for (auto& axis : frame.axes) axis = std::clamp((int)axis + (int)(random() % 41) - 20, -127, 127);
+    } else if (roll == 5) {
+      frame.buttons ^= 1 << (random() % 12);
+    } else if (roll == 6) {
+      frame.state = random() % 5;
+    } else if (roll == 7) {
+      frame.axes[random() % 4] = random() % 2 ? 127 : -127;  // Full stick jumps
+    }
+    frames[tick] = frame;
+  }
+  return frames;
+}
+
+std::vector<uint8_t> encode(const std::vector<controller_frame>& frames, size_t capacity, int& added) {
+  std::vector<uint8_t> buffer(capacity);
+  RecordingEncoder encoder(buffer.data(), buffer.size(), 10);
+  added = 0;
+  for (size_t tick = 0; tick < frames.size(); tick++) {
+    if (!encoder.add(tick, frames[tick])) break;
+    added++;
+  }
+  buffer.resize(encoder.finish());
+  return buffer;
+}
+
+void test_round_trip() {
+  std::vector<controller_frame> frames = session(6000, 1);
+  int added;
+  std::vector<uint8_t> buffer = encode(frames, 65536, added);
+  CHECK(added == (int)frames.size());
+  CHECK(buffer[5] == 10);  // Tick length
+
+  RecordingDecoder decoder(buffer.data(), buffer.size());
+  CHECK(decoder.valid());
+  int mismatches = 0;
+  for (size_t tick = 0; tick < frames.size(); tick++)
+    if (!frames_equal(decoder.at(tick), frames[tick])) mismatches++;
+  CHECK(mismatches == 0);
+  CHECK(decoder.done());
+}
+
+// A late tick applies every record it skipped over
+void test_skipped_ticks() {
+  std::vector<controller_frame> frames = session(3000, 2);
+  int added;
+  std::vector<uint8_t> buffer = encode(frames, 65536, added);
+
+  RecordingDecoder decoder(buffer.data(), buffer.size());
+  int mismatches = 0;
+  for (size_t tick = 0; tick < frames.size(); tick += 7)
+    if (!frames_equal(decoder.at(tick), frames[tick])) mismatches++;
+  CHECK(mismatches == 0);
+}
+
+// Nothing changing costs nothing
+void test_still_controller() {
+  std::vector<controller_frame> frames(1000);
+  int added;
+  std::vector<uint8_t> buffer = encode(frames, 64, added);
+  CHECK(added == 1000);
+  CHECK(buffer.size() == RECORDING_HEADER_SIZE + 1);
+}
+
+// A full buffer stops at a whole record and still plays back up to there
+void test_full_buffer() {
+  std::vector<controller_frame> frames = session(6000, 3);
+  int added;
+  std::vector<uint8_t> buffer = encode(frames, 512, added);
+  CHECK(added > 0 && added < (int)frames.size());
+  CHECK(buffer.size() <= 512);
+  CHECK(buffer.back() == RECORDING_END);
+
+  RecordingDecoder decoder(buffer.data(), buffer.size());
+  int mismatches = 0;
+  for (int tick = 0; tick < added; tick++)
+    if (!frames_equal(decoder.at(tick), frames[tick])) mismatches++;
+  CHECK(mismatches == 0);
+  CHECK(decoder.done());
+}
+
+void test_bad_header() {
+  uint8_t buffer[RECORDING_HEADER_SIZE + 1] = {'E', 'Z', 'R', 'C', RECORDING_VERSION + 1, 10, RECORDING_END};
+  CHECK(!RecordingDecoder(buffer, sizeof(buffer)).valid());
+  buffer[4] = RECORDING_VERSION;
+  CHECK(RecordingDecoder(buffer, sizeof(buffer)).valid());
+  CHECK(!RecordingDecoder(buffer, 3).valid());
+  CHECK(RecordingDecoder(buffer, sizeof(buffer)).done());
+}
+
+}  // namespace
+
+int main() {
+  test_round_trip();
+  test_skipped_ticks();
+  test_still_controller();
+  test_full_buffer();
+  test_bad_header();
+  return host_test_result();
+}
@@ -0,0 +1,164 @@
+// Telemetry decoder.
+//
+// Reads the COBS framed packets streamed by telemetry_start() (see include/telemetry_format.hpp)
+// and writes them out as CSV, one row per packet.  Frames that fail their CRC are dropped and
+// counted, and gaps in the sequence numbers are reported as lost packets.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/telemetry_decode.cpp src/telemetry_format.cpp -o telemetry_decode
+//   ./telemetry_decode /dev/ttyACM0 -o run.csv      live from the brain, until ctrl+c
+//   ./telemetry_decode capture.bin -o run.csv       from a saved capture
+//   ./telemetry_decode -f capture.bin               follow a capture that's still being written, like tail -f
+//
+// Without -o the CSV goes to stdout.
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "telemetry_format.hpp"
+
+namespace {
+
+volatile std::sig_atomic_t stop = 0;
+
+void handle_signal(int) { stop = 1; }
+
+// Puts a serial port into raw mode so bytes come through untouched
+bool serial_raw(int fd) {
+  termios tty;
+  if (tcgetattr(fd, &tty) != 0) return false;
+  cfmakeraw(&tty);
+  cfsetispeed(&tty, B115200);
+  cfsetospeed(&tty, B115200);
+  tty.c_cc[VMIN] = 0;
+  tty.c_cc[VTIME] = 1;  // Return from read() after 100 ms with nothing so ctrl+c is noticed
+  return tcsetattr(fd, TCSANOW, &tty) == 0;
+}
+
+void csv_header(FILE* out) {
+  fprintf(out,
+          "sequence,time,x,y,theta,left_velocity,right_velocity,drive_target,drive_error,drive_output,"
+          "turn_target,turn_error,turn_output,subsystem_state,subsystem_speed,balls_held,loop_time,task_cpu,cpu_load,cpu_other,stack_free_min\n");
+}
+
+void csv_row(FILE* out, const telemetry_packet& p) {
+  fprintf(out, "%u,%u,%.3f,%.3f,%.3f,%.2f,%.2f,%.3f,%.3f,%.2f,%.3f,%.3f,%.2f,%u,%u,%u,%u,%u,%u,%d,%u\n",
+          p.sequence, p.time, p.x, p.y, p.theta, p.left_velocity, p.right_velocity,
+          p.drive_target, p.drive_error, p.drive_output, p.turn_target, p.turn_error, p.turn_output,
+          p.subsystem_state, p.subsystem_speed, p.balls_held, p.loop_time,
+          p.task_cpu, p.cpu_load, p.cpu_other, p.stack_free_min);
+}
+
+struct decoder {
+  FILE* out;
+  uint8_t frame[TELEMETRY_FRAME_MAX];
+  size_t length = 0;
+  bool overflow = false;
+  bool have_sequence = false;
+  uint16_t last_sequence = 0;
+  long packets = 0, bad = 0, lost = 0;
+
+  void byte(uint8_t b) {
+    if (b != 0x00) {
+      if (length < sizeof(frame))
+        frame[length++] = b;
+      else
+        overflow = true;  // Too long to be a packet, probably text
+      return;
+    }
+
+    // End of a frame.  Frames start with a 0x00 too, so back to back ones leave nothing between
+    if (length > 0) {
+      telemetry_packet packet;
+      if (!overflow && telemetry_unframe(frame, length, packet)) {
+        if (have_sequence) lost += (uint16_t)(packet.sequence - last_sequence - 1);
+        have_sequence = true;
+        last_sequence = packet.sequence;
+        packets++;
+        csv_row(out, packet);
+      } else {
+        bad++;
+      }
+    }
+    length = 0;
+    overflow = false;
+  }
+};
+
+void usage() {
+  fprintf(stderr, "usage: telemetry_decode [-f] [-o output.csv] [input]\n");
+  fprintf(stderr, "  input is a capture file, a serial port like /dev/ttyACM0, or - for stdin (the default)\n");
+  fprintf(stderr, "  -f keeps reading at the end of a file, serial ports are always followed\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool follow = false;
+  std::string input = "-", output;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-f") == 0) {
+      follow = true;
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output = argv[++i];
+    } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+      usage();
+      return 1;
+    } else {
+      input = argv[i];
+    }
+  }
+
+  int fd = input == "-" ? STDIN_FILENO : open(input.c_str(), O_RDONLY | O_NOCTTY);
+  if (fd < 0) {
+    perror(input.c_str());
+    return 1;
+  }
+  if (isatty(fd)) {
+    if (!serial_raw(fd)) perror("serial setup");
+    follow = true;
+  }
+
+  FILE* out = output.empty() ? stdout : fopen(output.c_str(), "w");
+  if (out == nullptr) {
+    perror(output.c_str());
+    return 1;
+  }
+
+  std::signal(SIGINT, handle_signal);
+  std::signal(SIGTERM, handle_signal);
+
+  decoder decode;
+  decode.out = out;
+  csv_header(out);
+
+  uint8_t buffer[4096];
+  while (!stop) {
+    ssize_t count = read(fd, buffer, sizeof(buffer));
+    if (count < 0) {
+      if (errno == EINTR) continue;
+      perror("read");
+      break;
+    }
+    if (count == 0) {
+      if (!follow) break;
+      fflush(out);
+      usleep(20000);
+      continue;
+    }
+    for (ssize_t i = 0; i < count; i++) decode.byte(buffer[i]);
+    if (follow) fflush(out);  // So rows show up live
+  }
+
+  fflush(out);
+  if (out != stdout) fclose(out);
+  fprintf(stderr, "%ld packets, %ld bad frames, %ld lost\n", decode.packets, decode.bad, decode.lost);
+  return 0;
+}
@@ -0,0 +1,150 @@
+// VelocityLoop host test.
+//
+// Runs the conveyor and outtake velocity loop (the constants from src/conveyor.cpp) against a
+// model of a 200 rpm V5 motor driving a mechanism, with and without balls loading it down.
+// ez::PID is in EZ-Template's prebuilt library, so a PID that computes the same way stands in.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/velocity_controller_test.cpp -o velocity_controller_test
+//   ./velocity_controller_test
+
+#include <cmath>
+
+#include "host_test.hpp"
+#include "velocity_loop.hpp"
+
+namespace {
+
+const double DT = 0.01;  // s, the subsystem task's period
+
+// The parts of ez::PID the velocity loop uses.  i only builds inside start_i and, with
+// i_reset_toggle(false), isn't cleared when the error changes sign
+struct host_pid {
+  double kp, ki, kd, start_i;
+  double target = 0, integral = 0, prev_current = 0;
+  bool reset_i_sgn = true;
+  double prev_error = 0;
+
+  host_pid(double p, double i, double d, double start) : kp(p), ki(i), kd(d), start_i(start) {}
+  void target_set(double input) { target = input; }
+  void i_reset_toggle(bool toggle) { reset_i_sgn = toggle; }
+  void variables_reset() { integral = prev_current = prev_error = 0; }
+  double compute(double current) {
+    double error = target - current;
+    double derivative = current - prev_current;
+    if (ki != 0) {
+      if (std::fabs(error) < start_i) integral += error;
+      if (reset_i_sgn && std::signbit(error) != std::signbit(prev_error)) integral = 0;
+    }
+    prev_current = current;
+    prev_error = error;
+    return error * kp + integral * ki - derivative * kd;
+  }
+};
+
+using Loop = VelocityLoop<host_pid>;
+
+Loop conveyor_loop() { return Loop(0.635, 4.0, host_pid(0.4, 0.01, 0.0, 60.0)); }
+
+// 200 rpm at full power with nothing on it, a first order lag, friction that takes kS to break,
+// and a load that costs some rpm at any power
+struct motor_model {
+  double rpm = 0;
+  double load = 0;  // rpm lost to what the mechanism is pushing
+
+  void step(double power) {
+    const double FREE_SPEED = 200, TIME_CONSTANT = 0.06, FRICTION = 3.0;
+    double drive = std::fabs(power) <= FRICTION ? 0 : power - std::copysign(FRICTION, power);
+    double settled = drive / 127.0 * FREE_SPEED;
+    if (settled != 0) settled -= std::copysign(std::min(load, std::fabs(settled)), settled);
+    rpm += (settled - rpm) * DT / TIME_CONSTANT;
+  }
+};
+
+// Runs for some seconds, returns the output on the last tick
+double run(Loop& loop, motor_model& motor, double target, double seconds) {
+  double output = 0;
+  for (int i = 0; i < seconds / DT; i++) {
+    output = loop.iterate(target, motor.rpm);
+    motor.step(output);
+  }
+  return output;
+}
+
+void test_unloaded() {
+  Loop loop = conveyor_loop();
+  motor_model motor;
+  run(loop, motor, 150, 0.3);
+  CHECK(std::fabs(motor.rpm - 150) < 0.05 * 150);  // Feedforward gets most of the way quickly
+  run(loop, motor, 150, 1.0);
+  CHECK_NEAR(motor.rpm, 150, 2);
+}
+
+// Feedforward alone would be short by the whole load, the integral makes it up.  With ki = 0.01
+// that takes about a second per e-fold
+void test_loaded() {
+  Loop loop = conveyor_loop();
+  motor_model motor;
+  motor.load = 30;
+  run(loop, motor, 120, 0.5);
+  CHECK(motor.rpm > 120 - 30 / 2.0);  // P alone already takes up more than half the load
+  run(loop, motor, 120, 2.5);
+  CHECK_NEAR(motor.rpm, 120, 2);
+}
+
+// A ball hitting the belt mid run drops the speed, then it comes back
+void test_load_step() {
+  Loop loop = conveyor_loop();
+  motor_model motor;
+  run(loop, motor, 120, 1.0);
+  motor.load = 40;
+  double lowest = motor.rpm;
+  for (int i = 0; i < 0.2 / DT; i++) {
+    motor.step(loop.iterate(120, motor.rpm));
+    lowest = std::min(lowest, motor.rpm);
+  }
+  CHECK(lowest < 110);
+  run(loop, motor, 120, 3.0);
+  CHECK_NEAR(motor.rpm, 120, 2);
+}
+
+void test_reverse() {
+  Loop loop = conveyor_loop();
+  motor_model motor;
+  motor.load = 20;
+  run(loop, motor, -100, 2.0);
+  CHECK_NEAR(motor.rpm, -100, 2);
+}
+
+// More than the motor can do saturates instead of wrapping or going past 127
+void test_saturates() {
+  Loop loop = conveyor_loop();
+  motor_model motor;
+  motor.load = 50;
+  double output = run(loop, motor, 190, 2.0);
+  CHECK_NEAR(output, 127, 1e-9);
+}
+
+// Stopping clears the integral, so the next spin up doesn't start with the last one's
+void test_stop_resets() {
+  Loop loop = conveyor_loop();
+  motor_model motor;
+  motor.load = 30;
+  run(loop, motor, 120, 2.0);
+  CHECK(loop.pid.integral > 0);
+  CHECK(loop.iterate(0, motor.rpm) == 0);
+  CHECK(loop.pid.integral == 0);
+  CHECK_NEAR(loop.iterate(100, 0), 0.635 * 100 + 4.0 + 0.4 * 100, 1e-9);
+}
+
+}  // namespace
+
+int main() {
+  test_unloaded();
+  test_loaded();
+  test_load_step();
+  test_reverse();
+  test_saturates();
+  test_stop_resets();
+  return host_test_result();
+}
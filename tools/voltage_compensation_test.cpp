@@ -0,0 +1,116 @@
+// Voltage compensation host test.
+//
+// Drives a simulated drivetrain to a target with a PID at a full and a sagging battery.  With the
+// gains and max speed scaled by voltage_scale() the two runs should match, without it the low
+// battery run should be slower.  Also checks the scaling helpers themselves.
+//
+// Build and run on the host:
+//   g++ -std=c++20 -O2 -Iinclude tools/voltage_compensation_test.cpp -o voltage_compensation_test
+//   ./voltage_compensation_test
+
+#include <algorithm>
+#include <vector>
+
+#include "host_test.hpp"
+#include "voltage_scale.hpp"
+
+namespace {
+
+struct constants {
+  double kp;
+  double ki;
+  double kd;
+  double start_i;
+};
+
+const double NOMINAL = 11500;  // mV
+const double DT = 0.01;        // s
+
+// Drivetrain: top speed is proportional to motor voltage, with a first order lag
+const double SPEED_PER_MV = 60.0 / 12000;  // in/s at full 12 V
+const double TIME_CONSTANT = 0.15;         // s
+
+// Runs a PD to a target and returns the position every tick
+std::vector<double> drive(double battery, bool compensate, double target, int max_speed) {
+  const constants base = {8.0, 0.0, 30.0, 0.0};
+  double scale = compensate ? voltage_scale(NOMINAL, battery) : 1.0;
+  constants k = voltage_scale_constants(base, scale);
+  int speed = compensate ? voltage_scale_speed(max_speed, scale) : max_speed;
+
+  std::vector<double> positions;
+  double position = 0, velocity = 0, last_error = target;
+  for (int tick = 0; tick < 300; tick++) {
+    double error = target - position;
+    double output = k.kp * error + k.kd * (error - last_error);
+    last_error = error;
+    output = std::clamp(output, (double)-speed, (double)speed);
+
+    // The motor gets its share of whatever the battery is
+    double motor_mv = output / 127.0 * battery;
+    velocity += (motor_mv * SPEED_PER_MV - velocity) * DT / TIME_CONSTANT;
+    position += velocity * DT;
+    positions.push_back(position);
+  }
+  return positions;
+}
+
+double max_difference(const std::vector<double>& a, const std::vector<double>& b) {
+  double worst = 0;
+  for (size_t i = 0; i < a.size(); i++) worst = std::max(worst, std::fabs(a[i] - b[i]));
+  return worst;
+}
+
+void test_scale() {
+  CHECK_NEAR(voltage_scale(11500, 11500), 1.0, 1e-12);
+  CHECK_NEAR(voltage_scale(11500, 12800), 11500.0 / 12800, 1e-12);
+  CHECK_NEAR(voltage_scale(11500, 0), 1.0, 1e-12);  // Couldn't read the battery
+  CHECK_NEAR(voltage_scale(11500, -1), 1.0, 1e-12);
+
+  constants k = voltage_scale_constants(constants{2.0, 0.1, 10.0, 15.0}, 0.5);
+  CHECK_NEAR(k.kp, 1.0, 1e-12);
+  CHECK_NEAR(k.ki, 0.05, 1e-12);
+  CHECK_NEAR(k.kd, 5.0, 1e-12);
+  CHECK_NEAR(k.start_i, 15.0, 1e-12);
+
+  CHECK(voltage_scale_speed(110, 11500.0 / 12800) == 99);
+  CHECK(voltage_scale_speed(127, 11500.0 / 12800) == 114);
+  CHECK(voltage_scale_speed(110, 11500.0 / 11000) == 115);
+  CHECK(voltage_scale_speed(127, 11500.0 / 11000) == 127);  // Can't go past full power
+  CHECK(voltage_scale_speed(0, 2.0) == 0);
+}
+
+// Compensated runs match at any battery the robot can reach nominal from.  Max speed is rounded to
+// a whole number, so runs that hit it are off by that much
+void test_compensated() {
+  std::vector<double> full = drive(12800, true, 24, 110);
+  std::vector<double> sagging = drive(11800, true, 24, 110);
+  CHECK(max_difference(full, sagging) < 0.1);
+  CHECK(max_difference(drive(12800, true, 6, 110), drive(11800, true, 6, 110)) < 1e-6);
+  CHECK_NEAR(full.back(), 24, 0.05);
+}
+
+// Uncompensated, a sagging battery is slower, and a fresh one overshoots more
+void test_uncompensated() {
+  std::vector<double> full = drive(12800, false, 24, 110);
+  std::vector<double> sagging = drive(11800, false, 24, 110);
+  CHECK(max_difference(full, sagging) > 0.5);
+  CHECK(*std::max_element(full.begin(), full.end()) > *std::max_element(sagging.begin(), sagging.end()));
+}
+
+// Below nominal the max speed can't be raised past 127, so runs that hit it can't fully match
+void test_below_nominal() {
+  std::vector<double> nominal = drive(11500, true, 24, 127);
+  std::vector<double> low = drive(11000, true, 24, 127);
+  CHECK(low.back() > 23.5);
+  CHECK(low[30] <= nominal[30] + 1e-9);
+}
+
+}  // namespace
+
+int main() {
+  test_scale();
+  test_compensated();
+  test_uncompensated();
+  test_below_nominal();
+  return host_test_result();
+}